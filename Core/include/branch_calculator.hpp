@@ -0,0 +1,111 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        branch_calculator.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Branch currents, voltage drops and power of every component.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Reject circuits with subcircuit instances.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_BRANCH_CALCULATOR_HPP
+#define OCIRA_CORE_BRANCH_CALCULATOR_HPP
+
+#include "component.hpp"
+#include <armadillo>
+#include <complex>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class CircuitTransformer;
+
+/// @brief Voltage drop, current and power of every component of a solved circuit.
+/// Entry k belongs to componentIds[k]. The voltage is the voltage of the bus at the first
+/// connection of the component minus that at the second one, and the current flows from the first
+/// connection through the component to the second one. powers holds the complex power absorbed by
+/// each component: V * conj(I) in DC circuits and V * conj(I) / 2 in AC circuits, whose phasors
+/// are peak values. Sources that deliver power therefore have a negative real power.
+/// sourcePower is the power delivered by all sources and loadPower the power absorbed by all
+/// other components. By Tellegen's theorem they agree up to rounding.
+struct BranchQuantities {
+  std::vector<components::ComponentId> componentIds;
+  arma::cx_vec voltages;
+  arma::cx_vec currents;
+  arma::cx_vec powers;
+  std::complex<double> sourcePower;
+  std::complex<double> loadPower;
+};
+
+/// @brief Computes branch quantities from solution vectors.
+/// The constructor resolves the connections of every component once into flat index arrays, so
+/// computing the quantities of a solution is a single loop over those arrays without any pointer
+/// access. Every branch current has the form y * V + c + s * x_aux: y is the admittance of
+/// resistors, capacitors and inductors, c the current of current sources and s selects the
+/// auxiliary current of voltage sources. Ground stands for an extra zero entry of the solution,
+/// so no branch needs special cases. A calculator can be reused for every solution of the same
+/// transformation, for example the points of a sweep of source values. Ground and wires are not
+/// reported.
+class BranchCalculator {
+public:
+  /// @brief Resolves the components of a transformed circuit.
+  /// Component overrides and the frequency of the transformer's snapshot are used. Throws
+  /// std::runtime_error if the circuit has subcircuit instances, whose components have no branch
+  /// of their own and would be missing from the power balance.
+  /// @param transformer Transformer whose solutions will be processed.
+  explicit BranchCalculator(const CircuitTransformer &transformer);
+
+  /// @brief Default destructor.
+  ~BranchCalculator() = default;
+
+  /// @brief Computes the branch quantities of a solution.
+  /// Throws std::runtime_error if the solution does not have the size of the system.
+  /// @param solution Solution vector, as returned by CircuitCalculator.
+  /// @return Voltage drops, currents and powers.
+  BranchQuantities compute(const arma::cx_vec &solution) const;
+
+  /// @brief Returns the IDs of the reported components.
+  /// @return Const reference to the component IDs.
+  const std::vector<components::ComponentId> &getComponentIds() const noexcept;
+
+private:
+  arma::uword m_size;
+  double m_powerFactor;
+  std::vector<components::ComponentId> m_componentIds;
+  std::vector<arma::uword> m_first;
+  std::vector<arma::uword> m_second;
+  std::vector<arma::uword> m_auxiliary;
+  std::vector<std::complex<double>> m_admittances;
+  std::vector<std::complex<double>> m_currents;
+  std::vector<double> m_auxiliarySigns;
+  std::vector<bool> m_isSource;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_BRANCH_CALCULATOR_HPP
@@ -25,6 +25,10 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Move buses and components into the circuit.
+// - 2026-10-19 Martin Vidjeskog: Keep track of the arena holding the circuit elements.
+// - 2026-10-19 Martin Vidjeskog: Store subcircuit instances.
+// - 2026-10-19 Martin Vidjeskog: Store ports.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -35,6 +39,7 @@
 #define OCIRA_CORE_CIRCUIT_HPP
 
 #include "circuit_enums.hpp"
+#include "circuit_structs.hpp"
 #include <memory>
 #include <vector>
 
@@ -48,6 +53,10 @@ class Component;
 
 namespace ocira::core {
 
+// Forward declarations.
+class CircuitArena;
+class SubcircuitInstance;
+
 /// @brief Represents an electrical circuit composed of components and buses.
 /// Supports both DC and AC simulation modes.
 class Circuit {
@@ -71,13 +80,33 @@ public:
   const std::vector<std::shared_ptr<components::Bus>> &getBuses() const;
 
   /// @brief Sets the buses for the circuit.
+  /// Pass an rvalue to hand the vector over without copying.
   /// @param buses Vector of shared pointers to Bus objects.
   void setBuses(std::vector<std::shared_ptr<components::Bus>> buses);
 
   /// @brief Sets the components for the circuit.
+  /// Pass an rvalue to hand the vector over without copying.
   /// @param components Vector of shared pointers to Component objects.
   void setComponents(std::vector<std::shared_ptr<components::Component>> components);
 
+  /// @brief Returns the subcircuit instances placed in the circuit.
+  /// @return Const reference to the vector of instances.
+  const std::vector<std::shared_ptr<const SubcircuitInstance>> &getSubcircuitInstances() const;
+
+  /// @brief Sets the subcircuit instances of the circuit.
+  /// The port buses of every instance must be buses of this circuit.
+  /// @param instances Vector of shared pointers to SubcircuitInstance objects.
+  void setSubcircuitInstances(std::vector<std::shared_ptr<const SubcircuitInstance>> instances);
+
+  /// @brief Returns the ports of the circuit. Port number k + 1 is entry k.
+  /// @return Const reference to the vector of ports.
+  const std::vector<Port> &getPorts() const;
+
+  /// @brief Sets the ports of the circuit. Port number k + 1 is entry k.
+  /// Ports do not change the circuit and are only used by multiport analyses.
+  /// @param ports Vector of ports.
+  void setPorts(std::vector<Port> ports);
+
   /// @brief Sets the simulation mode for the circuit.
   /// @param mode Simulation mode (DC or AC).
   void setSimulationMode(SimulationMode mode);
@@ -97,9 +126,20 @@ public:
   /// @return circuit frequency.
   float getFrequency() const noexcept;
 
+  /// @brief Sets the arena that holds the circuit's buses and components.
+  /// @param arena Shared pointer to the arena, or nullptr for heap allocated elements.
+  void setArena(std::shared_ptr<CircuitArena> arena);
+
+  /// @brief Gets the arena that holds the circuit's buses and components.
+  /// @return Shared pointer to the arena, or nullptr if the elements are heap allocated.
+  std::shared_ptr<CircuitArena> getArena() const;
+
 private:
+  std::shared_ptr<CircuitArena> m_arena;
   std::vector<std::shared_ptr<components::Bus>> m_buses;
   std::vector<std::shared_ptr<components::Component>> m_components;
+  std::vector<std::shared_ptr<const SubcircuitInstance>> m_subcircuitInstances;
+  std::vector<Port> m_ports;
   SimulationMode m_simulationMode;
   float m_frequency;
 };
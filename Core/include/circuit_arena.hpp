@@ -0,0 +1,119 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_arena.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Slab arena for allocating circuit elements.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_CIRCUIT_ARENA_HPP
+#define OCIRA_CORE_CIRCUIT_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+/// @brief Bump allocator that hands out memory from a few large slabs.
+/// Individual allocations are never released; all slabs are freed together when the arena is
+/// destroyed. The arena is not thread safe for allocation.
+class CircuitArena {
+public:
+  /// @brief Default size of a single slab in bytes.
+  static constexpr size_t DEFAULT_SLAB_SIZE = 1 << 20;
+
+  /// @brief Constructs an empty arena. No memory is reserved until the first allocation.
+  /// @param slabSize Size of each slab in bytes.
+  explicit CircuitArena(size_t slabSize = DEFAULT_SLAB_SIZE);
+
+  /// @brief Default destructor. Releases all slabs.
+  ~CircuitArena() = default;
+
+  CircuitArena(const CircuitArena &) = delete;
+  CircuitArena &operator=(const CircuitArena &) = delete;
+
+  /// @brief Allocates a block of memory from the current slab, starting a new slab if needed.
+  /// @param bytes Size of the block in bytes.
+  /// @param alignment Required alignment of the block.
+  /// @return Pointer to the allocated block.
+  void *allocate(size_t bytes, size_t alignment);
+
+  /// @brief Returns the number of bytes handed out by the arena.
+  /// @return Allocated bytes, excluding alignment padding.
+  size_t getBytesAllocated() const noexcept;
+
+  /// @brief Returns the number of slabs reserved by the arena.
+  /// @return Slab count.
+  size_t getNumberOfSlabs() const noexcept;
+
+private:
+  size_t m_slabSize;
+  std::vector<std::unique_ptr<std::byte[]>> m_slabs;
+  std::byte *m_cursor;
+  size_t m_remaining;
+  size_t m_bytesAllocated;
+};
+
+/// @brief Standard allocator that places objects in a CircuitArena.
+/// Each copy of the allocator keeps the arena alive, so an element allocated with
+/// std::allocate_shared stays valid even if it outlives the circuit that created it.
+template <typename T> class ArenaAllocator {
+public:
+  using value_type = T;
+
+  /// @brief Constructs an allocator for the given arena.
+  /// @param arena Arena to allocate from.
+  explicit ArenaAllocator(std::shared_ptr<CircuitArena> arena) : m_arena(std::move(arena)) {}
+
+  /// @brief Rebinding constructor required by the standard library.
+  template <typename U> ArenaAllocator(const ArenaAllocator<U> &other) : m_arena(other.m_arena) {}
+
+  /// @brief Allocates storage for n objects of type T.
+  T *allocate(size_t n) { return static_cast<T *>(m_arena->allocate(n * sizeof(T), alignof(T))); }
+
+  /// @brief Does nothing. Memory is released when the arena is destroyed.
+  void deallocate(T *, size_t) noexcept {}
+
+  template <typename U> bool operator==(const ArenaAllocator<U> &other) const noexcept {
+    return m_arena == other.m_arena;
+  }
+
+  template <typename U> bool operator!=(const ArenaAllocator<U> &other) const noexcept {
+    return m_arena != other.m_arena;
+  }
+
+private:
+  template <typename U> friend class ArenaAllocator;
+
+  std::shared_ptr<CircuitArena> m_arena;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_CIRCUIT_ARENA_HPP
@@ -0,0 +1,123 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_builder.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Bulk construction of circuits from typed edge lists.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add arena allocation mode.
+// - 2026-10-19 Martin Vidjeskog: Document the diode descriptor.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_CIRCUIT_BUILDER_HPP
+#define OCIRA_CORE_CIRCUIT_BUILDER_HPP
+
+#include "bus.hpp"
+#include "circuit_enums.hpp"
+#include "component.hpp"
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+class CircuitArena;
+
+/// @brief Describes a single circuit element as an edge between two buses.
+/// The meaning of value depends on the component type: resistance (ohms), capacitance (farads),
+/// inductance (henries), current (amperes), voltage (volts) or the saturation current of a diode
+/// (amperes), whose anode is the POSITIVE terminal. For AC sources value is the amplitude and
+/// phase the phase offset in degrees. Ground only uses the first terminal and wire ignores the
+/// value.
+struct ComponentDescriptor {
+  ComponentType type;
+  components::ComponentId id;
+  float value;
+  components::BusId busA;
+  components::BusId busB;
+  TerminalRole roleA;
+  TerminalRole roleB;
+  float phase = 0.0f;
+};
+
+/// @brief Builds a circuit in one pass from bus and component descriptors.
+/// All storage is reserved up front, each bus and component is allocated exactly once and the
+/// connections are written without the duplicate checks done by ConnectionManager. Buses that are
+/// referenced by a descriptor but were never added explicitly are created automatically.
+/// In AllocationMode::ARENA the buses and components, including their shared_ptr control blocks,
+/// are placed in a CircuitArena owned by the circuit instead of separate heap allocations.
+class CircuitBuilder {
+public:
+  /// @brief Constructs an empty builder.
+  /// @param mode Simulation mode of the circuit to build.
+  /// @param allocationMode Where the buses and components of the circuit are allocated.
+  explicit CircuitBuilder(SimulationMode mode = SimulationMode::DC,
+                          AllocationMode allocationMode = AllocationMode::HEAP);
+
+  /// @brief Default destructor.
+  ~CircuitBuilder() = default;
+
+  /// @brief Reserves storage for the expected number of buses and components.
+  /// @param numberOfBuses Expected number of buses.
+  /// @param numberOfComponents Expected number of components.
+  void reserve(size_t numberOfBuses, size_t numberOfComponents);
+
+  /// @brief Adds a bus to the circuit. Needed only for buses that no component refers to.
+  /// @param id Unique identifier for the bus.
+  void addBus(components::BusId id);
+
+  /// @brief Adds a component to the circuit.
+  /// @param descriptor Description of the component and its connections.
+  void addComponent(const ComponentDescriptor &descriptor);
+
+  /// @brief Adds a list of components to the circuit.
+  /// @param descriptors Descriptions of the components and their connections.
+  void addComponents(const std::vector<ComponentDescriptor> &descriptors);
+
+  /// @brief Creates the circuit from the collected descriptors.
+  /// The builder is left empty and can be reused afterwards.
+  /// @return Shared pointer to the new circuit.
+  std::shared_ptr<Circuit> build();
+
+private:
+  SimulationMode m_simulationMode;
+  AllocationMode m_allocationMode;
+  std::vector<components::BusId> m_busIds;
+  std::vector<ComponentDescriptor> m_descriptors;
+
+  /// @brief Creates a disconnected component matching the descriptor.
+  /// @param descriptor Description of the component.
+  /// @param arena Arena to allocate the component from, or nullptr to allocate it on the heap.
+  /// @return Shared pointer to the new component.
+  static std::shared_ptr<components::Component>
+  _createComponent(const ComponentDescriptor &descriptor,
+                   const std::shared_ptr<CircuitArena> &arena);
+};
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_CIRCUIT_BUILDER_HPP
@@ -25,6 +25,11 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add AllocationMode.
+// - 2026-10-19 Martin Vidjeskog: Add ElementKind.
+// - 2026-10-19 Martin Vidjeskog: Add TRANSIENT simulation mode and IntegrationMethod.
+// - 2026-10-19 Martin Vidjeskog: Add DIODE component type.
+// - 2026-10-19 Martin Vidjeskog: Add NetworkParameterType.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -44,6 +49,7 @@ enum class ComponentType {
   CAPACITOR,
   DC_CURRENT_SOURCE,
   DC_VOLTAGE_SOURCE,
+  DIODE,
   GROUND,
   INDUCTOR,
   RESISTOR,
@@ -56,8 +62,25 @@ enum class ComponentType {
 enum class TerminalRole { POSITIVE, NEGATIVE };
 
 /// @brief Specifies the simulation mode for the circuit.
-/// Determines how components behave and which equations are applied.
-enum class SimulationMode { DC, AC };
+/// Determines how components behave and which equations are applied. TRANSIENT circuits are
+/// solved in the time domain by TransientAnalysis and may mix DC and AC sources.
+enum class SimulationMode { DC, AC, TRANSIENT };
+
+/// @brief Numerical integration method of transient analysis.
+enum class IntegrationMethod { BACKWARD_EULER, TRAPEZOIDAL };
+
+/// @brief Kind of network parameters of a multiport: impedance (Z), admittance (Y) or
+/// scattering (S) parameters.
+enum class NetworkParameterType { IMPEDANCE, ADMITTANCE, SCATTERING };
+
+/// @brief Specifies where the buses and components of a circuit are allocated.
+/// HEAP allocates every element separately, ARENA places all elements of a circuit in a few large
+/// slabs that are released together.
+enum class AllocationMode { HEAP, ARENA };
+
+/// @brief Kind of circuit element that a validation error refers to.
+/// NONE is used for errors that concern the circuit as a whole.
+enum class ElementKind { NONE, BUS, COMPONENT };
 
 /// @brief Validation error codes for circuit analysis.
 /// Error codes are grouped by category:
@@ -72,6 +95,7 @@ enum class ValidationErrorCode {
   GROUND_COMPONENT_MISSING = 1005,
   INCOMPATIBLE_COMPONENT_FOR_DC_SIMULATION = 2000,
   INCOMPATIBLE_COMPONENT_FOR_AC_SIMULATION = 2001,
+  INCOMPATIBLE_COMPONENT_FOR_TRANSIENT_SIMULATION = 2002,
 };
 
 } // namespace ocira::core
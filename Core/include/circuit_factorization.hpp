@@ -0,0 +1,104 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_factorization.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Reusable LU factorization of an admittance matrix.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_CIRCUIT_FACTORIZATION_HPP
+#define OCIRA_CORE_CIRCUIT_FACTORIZATION_HPP
+
+#include <armadillo>
+#include <vector>
+
+namespace ocira::core {
+
+/// @brief LU factorization of an admittance matrix, P * Y = L * U.
+/// Factorizing costs O(n^3), every solve after that costs O(n^2). A factorization can be shared
+/// between threads once constructed, as solving does not modify it.
+class CircuitFactorization {
+public:
+  /// @brief Factorizes a square admittance matrix.
+  /// Throws std::runtime_error if the matrix is not square or is singular.
+  /// @param Y Admittance matrix.
+  explicit CircuitFactorization(const arma::cx_mat &Y);
+
+  /// @brief Constructs a factorization from previously computed factors.
+  /// Throws std::runtime_error if the factors do not fit together or U is singular.
+  /// @param L Lower triangular factor with unit diagonal.
+  /// @param U Upper triangular factor.
+  /// @param permutation Row permutation, as returned by getPermutation.
+  CircuitFactorization(arma::cx_mat L, arma::cx_mat U, std::vector<arma::uword> permutation);
+
+  /// @brief Default destructor.
+  ~CircuitFactorization() = default;
+
+  /// @brief Solves Y * x = b.
+  /// @param b Right-hand side.
+  /// @return Solution x.
+  arma::cx_vec solve(const arma::cx_vec &b) const;
+
+  /// @brief Solves Y * X = B for several right-hand sides at once.
+  /// @param B Right-hand sides, one per column.
+  /// @return Solutions, one per column.
+  arma::cx_mat solve(const arma::cx_mat &B) const;
+
+  /// @brief Solves Y^T * x = b, with the non-conjugated transpose of Y.
+  /// @param b Right-hand side.
+  /// @return Solution x.
+  arma::cx_vec solveTransposed(const arma::cx_vec &b) const;
+
+  /// @brief Returns the dimension of the factorized matrix.
+  /// @return Number of rows of Y.
+  arma::uword getSize() const noexcept;
+
+  /// @brief Returns the lower triangular factor with unit diagonal.
+  /// @return Const reference to L.
+  const arma::cx_mat &getLower() const noexcept;
+
+  /// @brief Returns the upper triangular factor.
+  /// @return Const reference to U.
+  const arma::cx_mat &getUpper() const noexcept;
+
+  /// @brief Returns the row permutation: row k of P * Y is row getPermutation()[k] of Y.
+  /// @return Const reference to the permutation.
+  const std::vector<arma::uword> &getPermutation() const noexcept;
+
+private:
+  arma::cx_mat m_L;
+  arma::cx_mat m_U;
+  std::vector<arma::uword> m_permutation;
+
+  /// @brief Checks that the factors are square, of the same size and that U is not singular.
+  void _checkFactors() const;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_CIRCUIT_FACTORIZATION_HPP
@@ -0,0 +1,79 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_fingerprint.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Structural hashes of circuits.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_CIRCUIT_FINGERPRINT_HPP
+#define OCIRA_CORE_CIRCUIT_FINGERPRINT_HPP
+
+#include <cstdint>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Hashes of a circuit at three levels of detail.
+/// topology covers the simulation mode, the buses, the component types and identifiers and how
+/// the components are connected. admittance adds the frequency and the values of passive
+/// components, which together determine the admittance matrix. full adds the source values, so
+/// it determines the solution. Circuits that differ only in source values share topology and
+/// admittance hashes and can reuse a factorization.
+struct CircuitFingerprint {
+  uint64_t topology;
+  uint64_t admittance;
+  uint64_t full;
+
+  bool operator==(const CircuitFingerprint &other) const noexcept {
+    return topology == other.topology && admittance == other.admittance && full == other.full;
+  }
+
+  bool operator!=(const CircuitFingerprint &other) const noexcept { return !(*this == other); }
+};
+
+/// @brief Provides static methods for fingerprinting circuits.
+/// This class cannot be instantiated.
+class CircuitFingerprinter {
+public:
+  /// @brief Make the class non-instantiable.
+  CircuitFingerprinter() = delete;
+
+  /// @brief Computes the fingerprint of a circuit in one pass over its elements.
+  /// The hashes depend on the order of the buses and components. They are not cryptographic and
+  /// are only meant for cache lookups.
+  /// @param circuit Circuit to fingerprint.
+  /// @return Fingerprint of the circuit.
+  static CircuitFingerprint compute(const Circuit &circuit);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_CIRCUIT_FINGERPRINT_HPP
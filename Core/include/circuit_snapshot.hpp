@@ -0,0 +1,139 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_snapshot.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Immutable circuit snapshots with copy-on-write component overrides.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Keep the phase of amplitude-only overrides.
+// - 2026-10-19 Martin Vidjeskog: Share overrides with the parent variant through a chain.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_CIRCUIT_SNAPSHOT_HPP
+#define OCIRA_CORE_CIRCUIT_SNAPSHOT_HPP
+
+#include "circuit_enums.hpp"
+#include "component.hpp"
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Replacement value for a single component in a circuit variant.
+/// value has the same meaning as the component's primary parameter: resistance, capacitance,
+/// inductance, amperes, volts or AC amplitude. phase is only used by AC sources.
+struct ComponentOverride {
+  float value;
+  float phase;
+};
+
+/// @brief Immutable view of a circuit that variants can share.
+/// A snapshot holds the base circuit and the components it overrides. The overrides are a shared
+/// map plus a chain of the entries added since that map was built, so deriving a variant only
+/// adds one entry to the chain of its parent. Once the chain is longer than the square root of
+/// the map size (and at least MIN_CHAIN_LENGTH), the next variant merges both into a new map.
+/// A chain of k derivations therefore costs O(k sqrt(k)), and a lookup walks at most
+/// O(sqrt(k)) chain entries before the map. Snapshots are never modified after construction and
+/// can be used from many threads at once, provided that the base circuit itself is no longer
+/// edited.
+class CircuitSnapshot {
+public:
+  /// @brief Creates a snapshot of the circuit without any overrides.
+  /// The simulation mode and frequency of the circuit are captured at this point.
+  /// @param circuit Shared pointer to the base circuit.
+  explicit CircuitSnapshot(std::shared_ptr<const Circuit> circuit);
+
+  /// @brief Default destructor.
+  ~CircuitSnapshot() = default;
+
+  /// @brief Returns the base circuit shared by all variants.
+  /// @return Shared pointer to the base circuit.
+  const std::shared_ptr<const Circuit> &getCircuit() const noexcept;
+
+  /// @brief Returns the simulation mode of the snapshot.
+  /// @return Simulation mode.
+  SimulationMode getSimulationMode() const noexcept;
+
+  /// @brief Returns the frequency of the snapshot.
+  /// @return Frequency in hertz.
+  float getFrequency() const noexcept;
+
+  /// @brief Creates a variant in which one component has a different value.
+  /// Overrides for IDs that are not part of the circuit have no effect.
+  /// @param id Identifier of the component to override.
+  /// @param value New primary value of the component.
+  /// @param phase New phase in degrees. Only used by AC sources. If not given, the phase of the
+  /// component in this snapshot is kept, which costs a lookup of the component in the circuit
+  /// unless it is already overridden.
+  /// @return The new variant. This snapshot is left unchanged.
+  CircuitSnapshot withComponentValue(components::ComponentId id, float value,
+                                     std::optional<float> phase = std::nullopt) const;
+
+  /// @brief Creates a variant with a different frequency.
+  /// The frequency is handled as in Circuit::setFrequency.
+  /// @param frequency New frequency in hertz.
+  /// @return The new variant. This snapshot is left unchanged.
+  CircuitSnapshot withFrequency(float frequency) const;
+
+  /// @brief Looks up the override of a component.
+  /// @param id Identifier of the component.
+  /// @return Pointer to the override, or nullptr if the component keeps its base value.
+  const ComponentOverride *findOverride(components::ComponentId id) const;
+
+  /// @brief Returns the number of overridden components.
+  /// @return Override count.
+  size_t getNumberOfOverrides() const noexcept;
+
+  /// @brief Chain length up to which variants never merge their overrides into a new map.
+  static constexpr size_t MIN_CHAIN_LENGTH = 8;
+
+private:
+  using OverrideMap = std::unordered_map<components::ComponentId, ComponentOverride>;
+
+  /// @brief Override added by a variant on top of those of its parent.
+  struct OverrideEntry {
+    components::ComponentId id;
+    ComponentOverride value;
+    std::shared_ptr<const OverrideEntry> parent; // nullptr at the end of the chain.
+    size_t chainLength;                          // Entries from this one to the end of the chain.
+  };
+
+  std::shared_ptr<const Circuit> m_circuit;
+  std::shared_ptr<const OverrideMap> m_overrides;
+  std::shared_ptr<const OverrideEntry> m_chain;
+  size_t m_numberOfOverrides;
+  SimulationMode m_simulationMode;
+  float m_frequency;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_CIRCUIT_SNAPSHOT_HPP
@@ -25,6 +25,11 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add ValidationOptions.
+// - 2026-10-19 Martin Vidjeskog: Store validation errors as compact records.
+// - 2026-10-19 Martin Vidjeskog: Add Port.
+// - 2026-10-19 Martin Vidjeskog: Use BusId for the buses of ports.
+// - 2026-10-19 Martin Vidjeskog: Declare BusId here for all headers.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -35,6 +40,7 @@
 #define OCIRA_CORE_CIRCUIT_STRUCTS_HPP
 
 #include "circuit_enums.hpp"
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,6 +50,10 @@ namespace ocira::core::components {
 // Forward declarations.
 class Bus;
 
+/// @brief Unique identifier for a bus in a circuit.
+/// Each bus must have a distinct BusId.
+using BusId = uint32_t;
+
 } // namespace ocira::core::components
 
 namespace ocira::core {
@@ -55,21 +65,50 @@ struct Connection {
   TerminalRole role;
 };
 
+/// @brief A port of a circuit seen as a multiport, given by the IDs of its two buses.
+/// Port currents flow into the positive bus and out of the negative bus. The reference impedance
+/// in ohms normalizes the scattering parameters of the port.
+struct Port {
+  components::BusId positive;
+  components::BusId negative;
+  double referenceImpedance = 50.0;
+};
+
 /// @brief Describes a single validation error encountered during circuit analysis.
-/// Includes a human-readable message, an error code for programmatic handling,
-/// and an optional location string to pinpoint where the error occurred.
+/// The error is a small record of the error code and the element it concerns. The
+/// human-readable message and location are only rendered when asked for.
 struct ValidationError {
-  std::string message;
   ValidationErrorCode code;
-  std::string location;
+  ElementKind elementKind;
+  uint32_t elementId;
+
+  /// @brief Renders the human-readable message of the error.
+  /// @return Message, for example "Bus without connections.".
+  std::string getMessage() const;
+
+  /// @brief Renders the location of the error.
+  /// @return Location such as "Bus - 12", or an empty string for errors of the whole circuit.
+  std::string getLocation() const;
 };
 
 /// @brief Represents the outcome of a validation process.
 /// If the result is valid, no errors are present. Otherwise, the errors vector contains
-/// detailed information about each issue encountered.
+/// detailed information about each issue encountered. isTruncated tells whether validation
+/// stopped at the error limit, in which case more errors may exist.
 struct ValidationResult {
   bool isValid;
   std::vector<ValidationError> errors;
+  bool isTruncated = false;
+};
+
+/// @brief Options that control how a circuit is validated.
+struct ValidationOptions {
+  /// Number of threads. 1 validates on the calling thread, 0 uses all hardware threads.
+  uint32_t numberOfThreads = 1;
+  /// Maximum number of errors to report. 0 reports all errors.
+  size_t maxErrors = 0;
+  /// Stop at the first error. Same as a maxErrors of 1.
+  bool failFast = false;
 };
 
 } // namespace ocira::core
@@ -25,6 +25,13 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Transform circuit snapshots with component overrides.
+// - 2026-10-19 Martin Vidjeskog: Stamp subcircuit definitions once and replay per instance.
+// - 2026-10-19 Martin Vidjeskog: Reject transient circuits.
+// - 2026-10-19 Martin Vidjeskog: Transform the linear part of circuits with diodes.
+// - 2026-10-19 Martin Vidjeskog: Expose the transformed snapshot.
+// - 2026-10-19 Martin Vidjeskog: Expose the rows of voltage source currents.
+// - 2026-10-19 Martin Vidjeskog: Share the bus and voltage source numbering through numberCircuit.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -35,8 +42,11 @@
 #define OCIRA_CORE_CIRCUIT_TRANSFORMER_HPP
 
 #include "bus.hpp" // For BusId.
+#include "circuit_snapshot.hpp"
 #include <armadillo>
+#include <complex>
 #include <unordered_map>
+#include <vector>
 
 namespace ocira::core::components {
 
@@ -55,12 +65,42 @@ namespace ocira::core {
 
 // Forward declarations.
 class Circuit;
+class SubcircuitDefinition;
 
 /// @brief Unique identifier used for matrix computations.
 /// Each bus in the admittance matrix is assigned a sequential BusNumber.
 /// The ground bus is always assigned BusNumber 0.
 using BusNumber = uint32_t;
 
+/// @brief Single admittance matrix entry of a subcircuit stamp, in local node numbering.
+struct StampEntry {
+  uint32_t row;
+  uint32_t column;
+  std::complex<double> value;
+};
+
+/// @brief Contribution of a subcircuit definition to the Y matrix and J vector.
+/// Nodes are numbered as in SubcircuitDefinition::getLocalIndex. Each (row, column) pair appears
+/// at most once in admittances, and currents holds one value for every local node.
+struct SubcircuitStamp {
+  std::vector<StampEntry> admittances;
+  std::vector<std::complex<double>> currents;
+};
+
+/// @brief Row and column numbering of a circuit in modified nodal analysis.
+/// Buses connected to ground get number 0 and the other buses follow in the order of the
+/// circuit, then the internal buses of subcircuit instances. Bus number k is row k - 1. The
+/// auxiliary currents of voltage sources have their rows after the buses, in the order of the
+/// components.
+struct MnaNumbering {
+  std::unordered_map<components::BusId, BusNumber> busIdMap;
+  std::unordered_map<BusNumber, components::BusId> busNumberMap;
+  std::vector<BusNumber> instanceNodeOffsets;
+  std::unordered_map<components::ComponentId, arma::uword> voltageSourceRows;
+  uint32_t sizeG; // Number of bus rows.
+  uint32_t sizeB; // Number of voltage source rows.
+};
+
 /// @brief Transforms a circuit into its mathematical representation for simulation.
 /// Converts the circuit into an admittance matrix (Y) and a current vector (J),
 /// forming the equation Y * U = J, where U is the unknown voltage vector.
@@ -73,6 +113,15 @@ public:
   /// @param circuit Shared pointer to the circuit to be transformed.
   CircuitTransformer(const std::shared_ptr<Circuit> &circuit);
 
+  /// @brief Constructs a transformer for a circuit snapshot.
+  /// Throws std::runtime_error for transient circuits, which have no phasor representation, and
+  /// for circuits with diodes, which are solved by NonlinearSolver.
+  /// Component overrides and the frequency of the snapshot are used instead of the values stored
+  /// in the base circuit. The base circuit is only read, so several transformers can work on
+  /// variants of the same circuit in parallel.
+  /// @param snapshot Snapshot to be transformed.
+  explicit CircuitTransformer(const CircuitSnapshot &snapshot);
+
   /// @brief Default destructor.
   ~CircuitTransformer() = default;
 
@@ -96,18 +145,78 @@ public:
   /// @return Reference to the bus ID → bus number mapping.
   const std::unordered_map<components::BusId, BusNumber> &getBusIdMap() const;
 
+  /// @brief Returns the matrix bus number of a bus inside a subcircuit instance.
+  /// Ports resolve to the parent bus they are connected to. Internal buses of instances are
+  /// numbered after the buses of the circuit, so they have no entry in the bus maps.
+  /// @param instanceIndex Index of the instance in Circuit::getSubcircuitInstances.
+  /// @param busId Bus ID within the instance's definition.
+  /// @return Bus number, or 0 if the bus is connected to ground.
+  BusNumber getSubcircuitBusNumber(size_t instanceIndex, components::BusId busId) const;
+
+  /// @brief Returns the MNA row of the auxiliary current of a voltage source.
+  /// Voltage sources of the circuit have their rows after the buses, in the order of the
+  /// components. Throws std::runtime_error for components that are not such a voltage source.
+  /// @param id ID of the voltage source.
+  /// @return Row index in Y and J.
+  arma::uword getVoltageSourceRow(components::ComponentId id) const;
+
+  /// @brief Returns the snapshot that was transformed.
+  /// @return Const reference to the snapshot.
+  const CircuitSnapshot &getSnapshot() const noexcept;
+
+  /// @brief Numbers the buses and voltage sources of a circuit.
+  /// Shared by every analysis that builds an MNA system, so that their rows agree.
+  /// @param circuit Circuit to number.
+  /// @return The numbering.
+  static MnaNumbering numberCircuit(const Circuit &circuit);
+
+  /// @brief Returns the number of subcircuit definitions that were stamped.
+  /// Each definition is stamped once, however many instances of it the circuit contains.
+  /// @return Stamp count.
+  size_t getNumberOfSubcircuitStamps() const noexcept;
+
 private:
+  friend class NonlinearSolver;
+
   uint32_t m_sizeG; // G size
   uint32_t m_sizeB; // B size
-  std::shared_ptr<Circuit> m_circuit;
+  CircuitSnapshot m_snapshot;
   std::shared_ptr<arma::cx_mat> m_Y;
   std::shared_ptr<arma::cx_vec> m_J;
   std::unordered_map<BusNumber, components::BusId> m_busNumberMap;
   std::unordered_map<components::BusId, BusNumber> m_busIdMap;
+  std::unordered_map<components::ComponentId, arma::uword> m_voltageSourceRows;
+  std::vector<BusNumber> m_instanceNodeOffsets;
+  std::unordered_map<const SubcircuitDefinition *, SubcircuitStamp> m_subcircuitStamps;
+  bool m_skipNonlinear;
+
+  /// @brief Constructs a transformer for the linear part of a circuit snapshot.
+  /// Used by NonlinearSolver, which stamps the nonlinear components itself.
+  /// @param snapshot Snapshot to be transformed.
+  /// @param skipNonlinear Leave diodes out of Y and J instead of rejecting them.
+  CircuitTransformer(const CircuitSnapshot &snapshot, bool skipNonlinear);
+
+  /// @brief Returns the index of the auxiliary current of a voltage source, counted from the
+  /// first voltage source row.
+  /// @param component The voltage source.
+  /// @return Index of the voltage source.
+  uint32_t _getVoltageSourceIndex(const components::Component &component) const;
 
   /// @brief Populates the admittance matrix and current vector based on circuit components.
   void _transformComponents();
 
+  /// @brief Stamps each subcircuit definition once and adds it to the admittance matrix and
+  /// current vector for every instance.
+  void _transformSubcircuits();
+
+  /// @brief Computes the contribution of a subcircuit definition in local node numbering.
+  /// Component overrides of the snapshot do not apply to components inside definitions.
+  /// @param definition Definition to stamp.
+  /// @param frequency Circuit frequency.
+  /// @return The stamp of the definition.
+  static SubcircuitStamp _stampSubcircuit(const SubcircuitDefinition &definition,
+                                          float frequency);
+
   /// @brief Adds the contribution of a resistor to the admittance matrix.
   /// @param resistor Shared pointer to the resistor component.
   void _transformResistor(std::shared_ptr<components::Resistor> resistor);
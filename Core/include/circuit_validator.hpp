@@ -25,6 +25,9 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-28 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Fuse the checks into two sweeps with union-find connectivity.
+// - 2026-10-19 Martin Vidjeskog: Add parallel validation.
+// - 2026-10-19 Martin Vidjeskog: Stop at the error limit of the options.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -34,10 +37,14 @@
 #ifndef OCIRA_CORE_CIRCUIT_VALIDATOR_HPP
 #define OCIRA_CORE_CIRCUIT_VALIDATOR_HPP
 
+#include <cstddef>
+
 namespace ocira::core {
 
 /// Forward declarations.
 class Circuit;
+class ThreadPool;
+struct ValidationOptions;
 struct ValidationResult;
 
 /// @brief Provides static methods for validating the structure of a circuit.
@@ -48,48 +55,41 @@ public:
   CircuitValidator() = delete;
 
   /// @brief Validates the structure of the given circuit.
-  /// Checks for connectivity, grounding, and component compatibility.
+  /// Checks for connectivity, grounding, and component compatibility. All checks run in one sweep
+  /// over the buses and one over the components. Connectivity is tracked with a union-find
+  /// structure, so time is linear in the circuit size and the call stack does not grow with it.
   /// @param circuit Reference to the circuit to validate.
   /// @return A ValidationResult containing error codes and diagnostics.
   static ValidationResult isValidCircuit(const Circuit &circuit);
 
-private:
-  /// @brief Validates that every bus in the circuit is properly connected to at least one
-  /// component. Flags any buses that are left unconnected or floating, which may indicate design
-  /// errors.
-  /// @param circuit The circuit structure containing buses and components.
-  /// @param result  The validation result object used to collect errors and warnings.
-  static void _validateBusConnections(const Circuit &circuit, ValidationResult &result);
-
-  /// @brief Validates that all components within the circuit are properly connected to their
-  /// required buses. Detects and reports any components with missing or incmplete connections.
-  /// @param circuit The circuit model containing components and their connectivity data.
-  /// @param result  The validation result object used to collect errors and warnings.
-  static void _validateComponentConnections(const Circuit &circuit, ValidationResult &result);
-
-  /// @brief Validates the grounding configuration of the circuit to ensure that circuit has exactly
-  /// one ground component.
-  /// @param circuit The circuit model containing components and their connectivity data.
-  /// @param result  The validation result object used to collect errors and warnings.
-  static void _validateGround(const Circuit &circuit, ValidationResult &result);
+  /// @brief Validates the structure of the given circuit with the given options.
+  /// With more than one thread, buses and components are split into chunks that are checked
+  /// in parallel, connectivity uses a concurrent union-find structure and the partial results
+  /// are merged in a fixed order. The result is the same as that of isValidCircuit(circuit).
+  /// Circuits with fewer than PARALLEL_VALIDATION_THRESHOLD elements are validated on the
+  /// calling thread.
+  /// With an error limit, validation runs on the calling thread and returns as soon as the first
+  /// maxErrors errors are known. The reported errors are a prefix of the full error list.
+  /// @param circuit Reference to the circuit to validate.
+  /// @param options Validation options.
+  /// @return A ValidationResult containing error codes and diagnostics.
+  static ValidationResult isValidCircuit(const Circuit &circuit, const ValidationOptions &options);
 
-  /// @brief Validates that all components in the circuit support the circuit's simulation mode (AC
-  /// or DC).
-  /// @param circuit The circuit model containing components and their connectivity data.
-  /// @param result  The validation result object used to collect errors and warnings.
-  static void _validateSimulationModeCompatibility(const Circuit &circuit,
-                                                   ValidationResult &result);
+  /// @brief Number of buses and components below which validation is not worth parallelizing.
+  static constexpr size_t PARALLEL_VALIDATION_THRESHOLD = 16384;
 
-  /// @brief Validates that all buses and components in the circuit have unique identifiers.
-  /// @param circuit The circuit model containing buses, components, and their connectivity data.
-  /// @param result  The validation result object used to collect errors and warnings.
-  static void _validateUniqueIds(const Circuit &circuit, ValidationResult &result);
+private:
+  /// @brief Validates the circuit on the calling thread.
+  /// @param circuit Reference to the circuit to validate.
+  /// @param maxErrors Maximum number of errors to report.
+  /// @return A ValidationResult containing error codes and diagnostics.
+  static ValidationResult _isValidCircuitSequential(const Circuit &circuit, size_t maxErrors);
 
-  /// @brief Validates that all buses in the circuit are reachable from one another, ensuring full
-  /// connectivity.
-  /// @param circuit The circuit model containing buses, components, and their connectivity data.
-  /// @param result  The validation result object used to collect errors and warnings.
-  static void _validateConnectivity(const Circuit &circuit, ValidationResult &result);
+  /// @brief Validates the circuit on the threads of a pool.
+  /// @param circuit Reference to the circuit to validate.
+  /// @param pool Thread pool to run the checks on.
+  /// @return A ValidationResult containing error codes and diagnostics.
+  static ValidationResult _isValidCircuitParallel(const Circuit &circuit, ThreadPool &pool);
 };
 }; // namespace ocira::core
 
@@ -25,6 +25,7 @@
 //==============================================================================
 // Revision History:
 // - 2025-09-25 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add static phasor helper.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -64,6 +65,12 @@ public:
   /// @return Complex voltage phasor: amplitude * exp(j * phase_in_radians)
   std::complex<float> getPhasor() const noexcept;
 
+  /// @brief Computes the complex phasor of an amplitude and phase.
+  /// @param amplitude Peak voltage value.
+  /// @param phase Phase offset in degrees.
+  /// @return Complex voltage phasor: amplitude * exp(j * phase_in_radians)
+  static std::complex<float> computePhasor(float amplitude, float phase) noexcept;
+
   /// @brief Updates the amplitude of the voltage source.
   void setAmplitude(float amplitude) noexcept;
 
@@ -25,6 +25,10 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Allow CircuitBuilder to write connections directly.
+// - 2026-10-19 Martin Vidjeskog: Add allocation-free neighbor iteration.
+// - 2026-10-19 Martin Vidjeskog: Index the neighbor scratch space by dense bus indices.
+// - 2026-10-19 Martin Vidjeskog: Take BusId from circuit_structs.hpp.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -34,17 +38,53 @@
 #ifndef OCIRA_CORE_BUS_HPP
 #define OCIRA_CORE_BUS_HPP
 
+#include "circuit_structs.hpp" // For BusId.
+#include "component.hpp"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
+namespace ocira::core {
+
+// Forward declarations.
+class CircuitBuilder;
+
+} // namespace ocira::core
+
 namespace ocira::core::components {
 
 // Forward declarations.
 class Component;
 
-/// @brief Unique identifier for a bus in a circuit.
-/// Each bus must have a distinct BusId.
-using BusId = uint32_t;
+/// @brief Reusable scratch space for deduplicating buses without allocating.
+/// Buses are identified by a dense index that the caller assigns, for example the index of the
+/// bus in a validator. Each index is marked with the current epoch, so starting a new pass only
+/// increments a counter instead of clearing a set. The mark array grows to the largest index
+/// seen and is then reused.
+class NeighborScratch {
+public:
+  /// @brief Index that leaves a bus out of a neighbor walk.
+  static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+  /// @brief Constructs a scratch space.
+  /// @param size Number of indices to reserve room for.
+  explicit NeighborScratch(uint32_t size = 0);
+
+  /// @brief Default destructor.
+  ~NeighborScratch() = default;
+
+  /// @brief Starts a new pass. All indices become unmarked.
+  void nextEpoch();
+
+  /// @brief Marks an index in the current pass.
+  /// @param index Dense index of the bus to mark.
+  /// @return True if the index was not yet marked in the current pass; false otherwise.
+  bool mark(uint32_t index);
+
+private:
+  std::vector<uint32_t> m_marks;
+  uint32_t m_epoch;
+};
 
 /// @brief Represents a junction point in an electrical circuit.
 /// A Bus connects multiple components and serves as a node in the circuit graph.
@@ -94,7 +134,56 @@ public:
   /// @return A vector of weak pointers to buses linked through at least one component.
   const std::vector<std::weak_ptr<Bus>> getNeighborBuses() const;
 
+  /// @brief Calls the visitor once for every bus connected to this bus via components.
+  /// Unlike getNeighborBuses, no memory is allocated once the scratch space has grown to the
+  /// largest index. The scratch space must not be shared with a nested call.
+  /// @param scratch Scratch space used to skip buses that were already visited.
+  /// @param indexOf Callable taking a const Bus & and returning its dense index, or
+  /// NeighborScratch::NO_INDEX to leave the bus out.
+  /// @param visitor Callable taking a const std::shared_ptr<Bus> & and its index.
+  template <typename IndexOf, typename Visitor>
+  void forEachNeighborBus(NeighborScratch &scratch, const IndexOf &indexOf,
+                          Visitor &&visitor) const {
+    this->forEachNeighborBus(
+        scratch, [](const Component &) { return true; }, indexOf, visitor);
+  }
+
+  /// @brief Calls the visitor once for every bus connected to this bus via selected components.
+  /// @param scratch Scratch space used to skip buses that were already visited.
+  /// @param follows Callable taking a const Component & and returning whether the walk may
+  /// cross that component.
+  /// @param indexOf Callable taking a const Bus & and returning its dense index, or
+  /// NeighborScratch::NO_INDEX to leave the bus out.
+  /// @param visitor Callable taking a const std::shared_ptr<Bus> & and its index.
+  template <typename Follows, typename IndexOf, typename Visitor>
+  void forEachNeighborBus(NeighborScratch &scratch, const Follows &follows,
+                          const IndexOf &indexOf, Visitor &&visitor) const {
+    scratch.nextEpoch();
+    const uint32_t self = indexOf(*this);
+    if (self != NeighborScratch::NO_INDEX) {
+      scratch.mark(self);
+    }
+
+    for (const std::shared_ptr<Component> &component : this->m_components) {
+      if (!follows(*component)) {
+        continue;
+      }
+      for (const Connection &connection : component->getConnections()) {
+        std::shared_ptr<Bus> bus = connection.bus.lock();
+        if (!bus) {
+          continue;
+        }
+        const uint32_t index = indexOf(*bus);
+        if (index != NeighborScratch::NO_INDEX && scratch.mark(index)) {
+          visitor(bus, index);
+        }
+      }
+    }
+  }
+
 private:
+  friend class ocira::core::CircuitBuilder;
+
   BusId m_id;
   std::vector<std::shared_ptr<Component>> m_components;
 };
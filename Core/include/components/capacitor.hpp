@@ -25,6 +25,7 @@
 //==============================================================================
 // Revision History:
 // - 2025-09-08 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add static admittance helper.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -65,6 +66,12 @@ public:
   /// @return Admittance in siemens (complex value).
   std::complex<float> getAdmittance(const float frequency) const;
 
+  /// @brief Computes the complex admittance of a capacitance value at a given frequency.
+  /// @param capacitance Capacitance in farads.
+  /// @param frequency Frequency in hertz.
+  /// @return Admittance in siemens (complex value).
+  static std::complex<float> computeAdmittance(const float capacitance, const float frequency);
+
   /// @brief Updates the capacitance value.
   /// @param capacitance New capacitance value in farads.
   void setCapacitance(const float capacitance) noexcept;
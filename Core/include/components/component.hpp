@@ -25,6 +25,7 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Allow CircuitBuilder to write connections directly.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -38,6 +39,13 @@
 #include <memory>
 #include <vector>
 
+namespace ocira::core {
+
+// Forward declarations.
+class CircuitBuilder;
+
+} // namespace ocira::core
+
 namespace ocira::core::components {
 
 // Forward declarations.
@@ -94,6 +102,8 @@ protected:
   std::vector<Connection> m_connections;
 
 private:
+  friend class ocira::core::CircuitBuilder;
+
   ComponentId m_id;
 };
 } // namespace ocira::core::components
@@ -0,0 +1,93 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        diode.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Diode component model.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_DIODE_HPP
+#define OCIRA_CORE_DIODE_HPP
+
+#include "component.hpp"
+#include <cstdint>
+
+namespace ocira::core::components {
+
+/// @brief Represents a junction diode with the Shockley model
+/// I = Is * (exp(V / (n * Vt)) - 1).
+/// The anode is the terminal connected with TerminalRole::POSITIVE, the cathode the one connected
+/// with TerminalRole::NEGATIVE, and V is the anode voltage minus the cathode voltage. The diode
+/// is nonlinear, so circuits containing diodes are solved by NonlinearSolver.
+class Diode final : public Component {
+public:
+  /// @brief Thermal voltage kT / q at 300 K, in volts.
+  static constexpr double THERMAL_VOLTAGE = 0.025852;
+
+  /// @brief Constructs a diode with a unique ID and model parameters.
+  /// @param id Unique identifier for the diode.
+  /// @param saturationCurrent Saturation current Is in amperes.
+  /// @param emissionCoefficient Emission coefficient n, between 1 and 2 for silicon diodes.
+  explicit Diode(ComponentId id, float saturationCurrent, float emissionCoefficient = 1.0f);
+
+  /// @brief Destructor for the diode component.
+  ~Diode() override = default;
+
+  /// @brief Returns the saturation current.
+  /// @return Saturation current in amperes.
+  float getSaturationCurrent() const noexcept;
+
+  /// @brief Returns the emission coefficient.
+  /// @return Emission coefficient.
+  float getEmissionCoefficient() const noexcept;
+
+  /// @brief Computes the current through the diode at a junction voltage.
+  /// @param voltage Anode voltage minus cathode voltage in volts.
+  /// @return Current from anode to cathode in amperes.
+  double getCurrent(double voltage) const noexcept;
+
+  /// @brief Computes the small-signal conductance dI / dV at a junction voltage.
+  /// @param voltage Anode voltage minus cathode voltage in volts.
+  /// @return Conductance in siemens.
+  double getConductance(double voltage) const noexcept;
+
+  /// @brief Updates the saturation current.
+  /// @param saturationCurrent New saturation current in amperes.
+  void setSaturationCurrent(float saturationCurrent) noexcept;
+
+  /// @brief Updates the emission coefficient.
+  /// @param emissionCoefficient New emission coefficient.
+  void setEmissionCoefficient(float emissionCoefficient) noexcept;
+
+private:
+  float m_saturationCurrent;
+  float m_emissionCoefficient;
+};
+} // namespace ocira::core::components
+
+#endif // OCIRA_CORE_DIODE_HPP
@@ -25,6 +25,7 @@
 //==============================================================================
 // Revision History:
 // - 2025-09-11 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add static admittance helper.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -65,6 +66,12 @@ public:
   /// @return Admittance in siemens (complex value).
   std::complex<float> getAdmittance(const float frequency) const;
 
+  /// @brief Computes the complex admittance of an inductance value at a given frequency.
+  /// @param inductance Inductance in henries.
+  /// @param frequency Frequency in hertz.
+  /// @return Admittance in siemens (complex value).
+  static std::complex<float> computeAdmittance(const float inductance, const float frequency);
+
   /// @brief Updates the inductance value.
   /// @param inductance New inductance value in henries.
   void setInductance(const float inductance) noexcept;
@@ -25,6 +25,7 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add static conductance helper.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -62,6 +63,11 @@ public:
   /// @return Conductance in siemens.
   float getConductance() const;
 
+  /// @brief Calculates the conductance of a resistance value.
+  /// @param resistance Resistance in ohms.
+  /// @return Conductance in siemens.
+  static float computeConductance(float resistance);
+
   /// @brief Updates the resistance value of the resistor.
   /// @param resistance New resistance value in ohms.
   void setResistance(float resistance) noexcept;
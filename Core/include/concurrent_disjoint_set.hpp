@@ -0,0 +1,79 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        concurrent_disjoint_set.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Lock-free disjoint-set (union-find) structure.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_CONCURRENT_DISJOINT_SET_HPP
+#define OCIRA_CORE_CONCURRENT_DISJOINT_SET_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace ocira::core {
+
+/// @brief Disjoint-set (union-find) structure over the indices 0..n-1 that many threads can
+/// update at once.
+/// Roots are always linked below a root with a smaller index using compare-and-swap, and paths
+/// are halved on the way up. The final partition does not depend on the order of the unions.
+class ConcurrentDisjointSet {
+public:
+  /// @brief Constructs a structure with the given number of singleton sets.
+  /// @param size Number of elements.
+  explicit ConcurrentDisjointSet(uint32_t size);
+
+  /// @brief Default destructor.
+  ~ConcurrentDisjointSet() = default;
+
+  /// @brief Finds the representative of the set containing an element.
+  /// The representative is the smallest index in the set once all unions have finished.
+  /// @param index Element index.
+  /// @return Index of the representative.
+  uint32_t find(uint32_t index);
+
+  /// @brief Merges the sets containing two elements.
+  /// @param a First element index.
+  /// @param b Second element index.
+  /// @return True if this call merged two different sets.
+  bool unite(uint32_t a, uint32_t b);
+
+  /// @brief Returns the number of elements.
+  /// @return Element count.
+  uint32_t getSize() const noexcept;
+
+private:
+  std::unique_ptr<std::atomic<uint32_t>[]> m_parents;
+  uint32_t m_size;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_CONCURRENT_DISJOINT_SET_HPP
@@ -0,0 +1,103 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        contingency_analysis.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Single-outage (N-1) contingency analysis by rank-one updates.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+#ifndef OCIRA_CORE_CONTINGENCY_ANALYSIS_HPP
+#define OCIRA_CORE_CONTINGENCY_ANALYSIS_HPP
+
+#include "bus.hpp"
+#include "component.hpp"
+#include "thread_pool.hpp"
+#include <armadillo>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Settings of a contingency analysis.
+/// An outage violates the limits if the voltage magnitude of a bus other than ground leaves
+/// [minimumVoltage, maximumVoltage]. An outage islands buses if the rank-one update divides by
+/// less than islandingTolerance, which means that the system without the component is singular.
+struct ContingencyOptions {
+  double minimumVoltage = 0.0;
+  double maximumVoltage = std::numeric_limits<double>::infinity();
+  double islandingTolerance = 1e-9;
+};
+
+/// @brief Bus voltages of a circuit with each of its components removed in turn.
+/// busIds lists the buses in the order of Circuit::getBuses and componentIds the outaged
+/// components in the order of Circuit::getComponents. Column m of voltages holds the bus voltages
+/// without componentIds[m], row k belongs to busIds[k]. Columns of islanding outages are zero.
+struct ContingencyResult {
+  std::vector<components::BusId> busIds;
+  std::vector<components::ComponentId> componentIds;
+  arma::cx_vec baseVoltages;
+  arma::cx_mat voltages;
+  std::vector<bool> isIslanding;
+  std::vector<bool> violatesLimits;
+  uint64_t numberOfIslandingOutages;
+  uint64_t numberOfViolatingOutages;
+};
+
+/// @brief Provides static methods for N-1 contingency analysis of DC and AC circuits.
+/// Removing a resistor, capacitor or inductor with admittance y between buses i and j changes the
+/// admittance matrix by -y * a * a^T with a = e_i - e_j. By the Sherman-Morrison formula the new
+/// solution is x + z * y * (a^T * x) / (1 - y * a^T * z) with Y * z = a, so every outage costs
+/// one solve with the factorization of the intact circuit and O(n) work, and the matrix is
+/// factorized once. The denominator is the ratio of the determinants of the two matrices, so it
+/// vanishes exactly when the outage leaves buses without a path to ground. Removing a current
+/// source subtracts its own solution, Y^{-1} * J_source. Voltage sources change the size of the
+/// system and are not outaged. Only components at the top level of the circuit are outaged.
+/// This class cannot be instantiated.
+class ContingencyAnalysis {
+public:
+  /// @brief Make the class non-instantiable.
+  ContingencyAnalysis() = delete;
+
+  /// @brief Solves every single-component outage on the threads of a pool.
+  /// Throws std::runtime_error if the circuit is a transient circuit, is not valid or its intact
+  /// system is singular, or if the voltage limits are not ordered.
+  /// @param circuit Circuit to analyse. It must not be edited during the analysis.
+  /// @param options Settings of the analysis.
+  /// @param pool Thread pool that solves the outages.
+  /// @return Voltages and flags of every outage.
+  static ContingencyResult run(const std::shared_ptr<const Circuit> &circuit,
+                               const ContingencyOptions &options, ThreadPool &pool);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_CONTINGENCY_ANALYSIS_HPP
@@ -0,0 +1,103 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        dc_sweep.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: DC analysis of a circuit over a grid of source values.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_DC_SWEEP_HPP
+#define OCIRA_CORE_DC_SWEEP_HPP
+
+#include "component.hpp"
+#include <armadillo>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief One swept source and the values it takes, in volts or amperes.
+struct DCSweepAxis {
+  components::ComponentId sourceId;
+  std::vector<float> values;
+};
+
+/// @brief Solutions of a DC circuit on a grid of source values.
+/// The grid holds every combination of the axis values, with the last axis varying fastest: the
+/// point with value index i_a on axis a is column sum_a i_a * prod_{b > a} n_b, where n_b is the
+/// number of values of axis b. Columns are laid out like the solutions of CircuitCalculator.
+struct DCSweepResult {
+  std::vector<DCSweepAxis> axes;
+  arma::cx_mat solutions;
+};
+
+/// @brief Provides static methods for sweeping DC sources.
+/// Source values only enter the current vector J, so the admittance matrix of the circuit is
+/// transformed and factorized once. The right-hand sides of all grid points are built from the
+/// nominal J plus the change of every swept source and solved as one block of forward and back
+/// substitutions. The circuit is never modified.
+/// This class cannot be instantiated.
+class DCSweep {
+public:
+  /// @brief Make the class non-instantiable.
+  DCSweep() = delete;
+
+  /// @brief Returns evenly spaced values, including both end points.
+  /// Throws std::runtime_error if numberOfPoints is zero.
+  /// @param start First value.
+  /// @param stop Last value.
+  /// @param numberOfPoints Number of values.
+  /// @return Values.
+  static std::vector<float> linearValues(float start, float stop, uint32_t numberOfPoints);
+
+  /// @brief Solves a DC circuit for every combination of source values.
+  /// Throws std::runtime_error if the circuit is not a valid DC circuit or is singular, if there
+  /// are no axes, if an axis has no values, or if a source is not a DC voltage or current
+  /// source of the circuit or is swept twice.
+  /// @param circuit Circuit to solve.
+  /// @param axes Swept sources, outermost first.
+  /// @return Solutions on the grid.
+  static DCSweepResult run(const std::shared_ptr<const Circuit> &circuit,
+                           const std::vector<DCSweepAxis> &axes);
+
+  /// @brief Solves a DC circuit for a list of values of one source.
+  /// @param circuit Circuit to solve.
+  /// @param sourceId Swept source.
+  /// @param values Source values.
+  /// @return Solutions, one column per value.
+  static DCSweepResult run(const std::shared_ptr<const Circuit> &circuit,
+                           components::ComponentId sourceId, const std::vector<float> &values);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_DC_SWEEP_HPP
@@ -0,0 +1,85 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        disjoint_set.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Disjoint-set (union-find) structure over dense indices.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_DISJOINT_SET_HPP
+#define OCIRA_CORE_DISJOINT_SET_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace ocira::core {
+
+/// @brief Disjoint-set (union-find) structure over the indices 0..n-1.
+/// Uses union by size and path halving. All operations are iterative, so the structure can be
+/// used on circuits of any size without growing the call stack.
+class DisjointSet {
+public:
+  /// @brief Constructs a structure with the given number of singleton sets.
+  /// @param size Number of elements.
+  explicit DisjointSet(uint32_t size = 0);
+
+  /// @brief Default destructor.
+  ~DisjointSet() = default;
+
+  /// @brief Adds a new singleton set.
+  /// @return Index of the new element.
+  uint32_t add();
+
+  /// @brief Finds the representative of the set containing an element.
+  /// @param index Element index.
+  /// @return Index of the representative.
+  uint32_t find(uint32_t index);
+
+  /// @brief Merges the sets containing two elements.
+  /// @param a First element index.
+  /// @param b Second element index.
+  /// @return True if the sets were different, false if the elements were already in one set.
+  bool unite(uint32_t a, uint32_t b);
+
+  /// @brief Returns the number of elements.
+  /// @return Element count.
+  uint32_t getSize() const noexcept;
+
+  /// @brief Returns the number of disjoint sets.
+  /// @return Set count.
+  uint32_t getNumberOfSets() const noexcept;
+
+private:
+  std::vector<uint32_t> m_parents;
+  std::vector<uint32_t> m_sizes;
+  uint32_t m_numberOfSets;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_DISJOINT_SET_HPP
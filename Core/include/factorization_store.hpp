@@ -0,0 +1,90 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        factorization_store.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Versioned on-disk store of admittance matrix factorizations.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_FACTORIZATION_STORE_HPP
+#define OCIRA_CORE_FACTORIZATION_STORE_HPP
+
+#include "circuit_factorization.hpp"
+#include "circuit_fingerprint.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ocira::core {
+
+/// @brief Directory of factorization files that survives process restarts.
+/// Each file holds the LU factors of one admittance matrix and is named after the admittance
+/// fingerprint of its circuit. The file starts with a magic number, a format version, a byte
+/// order marker and both the topology and admittance hashes, so files written by another
+/// version, on another platform or for another circuit are ignored instead of misread. Files are
+/// written to a temporary name and renamed into place, so concurrent workers never load a
+/// partially written file.
+class FactorizationStore {
+public:
+  /// @brief Version of the file format. Files with another version are treated as missing.
+  static constexpr uint32_t FORMAT_VERSION = 1;
+
+  /// @brief Constructs a store in a directory. The directory is created if it does not exist.
+  /// Throws std::runtime_error if the directory cannot be created.
+  /// @param directory Path of the cache directory.
+  explicit FactorizationStore(std::string directory);
+
+  /// @brief Default destructor.
+  ~FactorizationStore() = default;
+
+  /// @brief Returns the path of the file for a fingerprint.
+  /// @param fingerprint Fingerprint of the circuit.
+  /// @return Path of the file, whether it exists or not.
+  std::string getPath(const CircuitFingerprint &fingerprint) const;
+
+  /// @brief Writes a factorization to the store, replacing any previous file.
+  /// @param fingerprint Fingerprint of the circuit the factorization belongs to.
+  /// @param factorization Factorization of the admittance matrix of the circuit.
+  /// @return True if the file was written, false on an I/O error.
+  bool save(const CircuitFingerprint &fingerprint,
+            const CircuitFactorization &factorization) const;
+
+  /// @brief Reads the factorization for a fingerprint.
+  /// Missing, truncated, stale and foreign files are all reported as a miss.
+  /// @param fingerprint Fingerprint of the circuit.
+  /// @return Shared pointer to the factorization, or nullptr if none could be loaded.
+  std::shared_ptr<const CircuitFactorization>
+  load(const CircuitFingerprint &fingerprint) const;
+
+private:
+  std::string m_directory;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_FACTORIZATION_STORE_HPP
@@ -0,0 +1,161 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        frequency_sweep.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Parallel AC analysis of a circuit over a list of frequencies.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_FREQUENCY_SWEEP_HPP
+#define OCIRA_CORE_FREQUENCY_SWEEP_HPP
+
+#include "thread_pool.hpp"
+#include <armadillo>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+class CircuitSnapshot;
+
+/// @brief Solutions of a circuit at a list of frequencies.
+/// Column k of solutions is the solution vector, as returned by CircuitCalculator, at
+/// frequencies[k]. Every column is contiguous in memory.
+struct FrequencySweepResult {
+  std::vector<float> frequencies;
+  arma::cx_mat solutions;
+};
+
+/// @brief Settings of an adaptive frequency sweep.
+/// An interval is split while the solution at its midpoint differs from the linear interpolation
+/// of its end points by more than tolerance times the largest solution magnitude seen so far.
+/// The coarse grid must be fine enough that every resonance bends at least one coarse interval.
+struct AdaptiveSweepOptions {
+  uint32_t initialPoints = 11;
+  double tolerance = 1e-3;
+  uint32_t maxPoints = 10000;
+  bool logarithmic = true;
+};
+
+/// @brief Result of an adaptive frequency sweep.
+/// The frequencies of the sweep are sorted in ascending order. numberOfDenseSolves is the size of
+/// a uniform grid, on the same scale, whose spacing equals the finest interval of the adaptive
+/// grid, which is the dense grid needed for the same accuracy.
+struct AdaptiveSweepResult {
+  FrequencySweepResult sweep;
+  size_t numberOfSolves;
+  size_t numberOfDenseSolves;
+  bool converged;
+};
+
+/// @brief Provides static methods for solving an AC circuit at many frequencies.
+/// The circuit is never modified. Each frequency point is a CircuitSnapshot variant of the
+/// circuit, so the points can be transformed and solved on several threads at once.
+/// This class cannot be instantiated.
+class FrequencySweep {
+public:
+  /// @brief Make the class non-instantiable.
+  FrequencySweep() = delete;
+
+  /// @brief Returns evenly spaced frequencies, including both end points.
+  /// Throws std::runtime_error if a frequency is negative or numberOfPoints is zero.
+  /// @param start First frequency in hertz.
+  /// @param stop Last frequency in hertz.
+  /// @param numberOfPoints Number of frequencies.
+  /// @return Frequencies in hertz.
+  static std::vector<float> linearPoints(float start, float stop, uint32_t numberOfPoints);
+
+  /// @brief Returns logarithmically spaced frequencies, including both end points.
+  /// Throws std::runtime_error if a frequency is not positive or numberOfPoints is zero.
+  /// @param start First frequency in hertz.
+  /// @param stop Last frequency in hertz.
+  /// @param numberOfPoints Number of frequencies.
+  /// @return Frequencies in hertz.
+  static std::vector<float> logarithmicPoints(float start, float stop, uint32_t numberOfPoints);
+
+  /// @brief Solves a circuit at every frequency of a list, using the threads of a pool.
+  /// The circuit is validated once, since its topology is the same at every frequency.
+  /// Throws std::runtime_error if the circuit is not an AC circuit, is not valid or if the list
+  /// is empty.
+  /// @param circuit Circuit to solve. It must not be edited during the sweep.
+  /// @param frequencies Frequencies in hertz, in any order.
+  /// @param pool Thread pool that solves the points.
+  /// @return Solutions in the order of the frequencies.
+  static FrequencySweepResult run(const std::shared_ptr<const Circuit> &circuit,
+                                  const std::vector<float> &frequencies, ThreadPool &pool);
+
+  /// @brief Solves a circuit at every frequency of a list on a temporary thread pool.
+  /// @param circuit Circuit to solve. It must not be edited during the sweep.
+  /// @param frequencies Frequencies in hertz, in any order.
+  /// @param numberOfThreads Number of threads. Zero selects the number of hardware threads.
+  /// @return Solutions in the order of the frequencies.
+  static FrequencySweepResult run(const std::shared_ptr<const Circuit> &circuit,
+                                  const std::vector<float> &frequencies,
+                                  uint32_t numberOfThreads = 0);
+
+  /// @brief Solves a circuit on a grid that is refined only where the response bends.
+  /// Starts from a coarse linear or logarithmic grid and repeatedly solves the midpoints of all
+  /// intervals that are not yet within tolerance, one parallel batch per refinement level.
+  /// Every solved midpoint is kept as a sample. Throws std::runtime_error as run does, or if the
+  /// options or the range are not valid.
+  /// @param circuit Circuit to solve. It must not be edited during the sweep.
+  /// @param start First frequency in hertz.
+  /// @param stop Last frequency in hertz, greater than start.
+  /// @param options Settings of the sweep.
+  /// @param pool Thread pool that solves the points.
+  /// @return Sorted samples and solve counts. converged is false if maxPoints was reached first.
+  static AdaptiveSweepResult runAdaptive(const std::shared_ptr<const Circuit> &circuit,
+                                         float start, float stop,
+                                         const AdaptiveSweepOptions &options, ThreadPool &pool);
+
+private:
+  /// @brief Throws std::runtime_error unless the circuit is a valid AC circuit.
+  /// @param circuit Circuit to check.
+  static void _checkCircuit(const Circuit &circuit);
+
+  /// @brief Solves a batch of frequency points on the threads of a pool.
+  /// @param base Snapshot of the circuit.
+  /// @param frequencies Frequencies in hertz, not empty.
+  /// @param pool Thread pool that solves the points.
+  /// @return Solutions, one column per frequency.
+  static arma::cx_mat _solveBatch(const CircuitSnapshot &base,
+                                  const std::vector<float> &frequencies, ThreadPool &pool);
+
+  /// @brief Transforms and solves one frequency point.
+  /// @param base Snapshot of the circuit.
+  /// @param frequency Frequency in hertz.
+  /// @return Solution vector.
+  static arma::cx_vec _solvePoint(const CircuitSnapshot &base, float frequency);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_FREQUENCY_SWEEP_HPP
@@ -0,0 +1,191 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        incremental_validator.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Circuit validation that is kept up to date while the circuit is edited.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Reject circuits with subcircuit instances.
+// - 2026-10-19 Martin Vidjeskog: Split only the affected set when edits remove connections.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_INCREMENTAL_VALIDATOR_HPP
+#define OCIRA_CORE_INCREMENTAL_VALIDATOR_HPP
+
+#include "bus.hpp"
+#include "circuit_enums.hpp"
+#include "circuit_structs.hpp"
+#include "component.hpp"
+#include "disjoint_set.hpp"
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Validates a circuit while it is being edited.
+/// The validator keeps the state of every check between calls: sets of unconnected and
+/// incompatible elements, a ground counter, identifier counts and a union-find structure for
+/// connectivity over the tracked buses and components. getResult only rebuilds its error list
+/// after a change.
+///
+/// Adding a bus, a component or a connection updates that state in O(log n). A union-find
+/// structure cannot split a set, so removals cost more: the validator searches from the buses
+/// that the removed element joined, one step per search in turn, until the searches meet or all
+/// but one have explored their part of the circuit. The parts that split off get new entries in
+/// the union-find structure. A removal therefore costs time in proportion to the parts it splits
+/// off, or to the length of the shortest detour around the removed element, which is O(n) in the
+/// worst case. Stale entries are dropped by a full rebuild once they outnumber the buses.
+///
+/// Errors are grouped by check in the same order as CircuitValidator::isValidCircuit. Within a
+/// check they are ordered by identifier. Subcircuit instances are not supported.
+class IncrementalValidator {
+public:
+  /// @brief Constructs a validator for an empty circuit.
+  /// @param mode Simulation mode of the circuit.
+  explicit IncrementalValidator(SimulationMode mode = SimulationMode::DC);
+
+  /// @brief Constructs a validator for the current state of a circuit.
+  /// Throws std::runtime_error if the circuit has subcircuit instances, whose ports connect
+  /// buses that the validator cannot see.
+  /// @param circuit Circuit whose buses and components are tracked from now on.
+  explicit IncrementalValidator(const Circuit &circuit);
+
+  /// @brief Default destructor.
+  ~IncrementalValidator() = default;
+
+  /// @brief Starts tracking a bus, together with its existing connections.
+  /// @param bus Shared pointer to the bus.
+  void addBus(const std::shared_ptr<components::Bus> &bus);
+
+  /// @brief Stops tracking a bus. Its connections are left as they are.
+  /// @param bus Shared pointer to the bus.
+  /// @return True if the bus was tracked.
+  bool removeBus(const std::shared_ptr<components::Bus> &bus);
+
+  /// @brief Starts tracking a component, together with its existing connections.
+  /// @param component Shared pointer to the component.
+  void addComponent(const std::shared_ptr<components::Component> &component);
+
+  /// @brief Stops tracking a component. Its connections are left as they are.
+  /// @param component Shared pointer to the component.
+  /// @return True if the component was tracked.
+  bool removeComponent(const std::shared_ptr<components::Component> &component);
+
+  /// @brief Connects a bus and a component and updates the validation state.
+  /// @param bus Shared pointer to the bus.
+  /// @param component Shared pointer to the component.
+  /// @param role Terminal role for the new connection.
+  void connect(const std::shared_ptr<components::Bus> &bus,
+               const std::shared_ptr<components::Component> &component, TerminalRole role);
+
+  /// @brief Disconnects a bus and a component and updates the validation state.
+  /// @param bus Shared pointer to the bus.
+  /// @param component Shared pointer to the component.
+  void disconnect(const std::shared_ptr<components::Bus> &bus,
+                  const std::shared_ptr<components::Component> &component);
+
+  /// @brief Changes the simulation mode that components are checked against.
+  /// @param mode Simulation mode (DC or AC).
+  void setSimulationMode(SimulationMode mode);
+
+  /// @brief Returns the validation result for the current state of the circuit.
+  /// @return Const reference to the result. It stays valid until the next edit.
+  const ValidationResult &getResult();
+
+private:
+  SimulationMode m_simulationMode;
+  std::unordered_multimap<components::BusId, std::shared_ptr<components::Bus>> m_buses;
+  std::unordered_multimap<components::ComponentId, std::shared_ptr<components::Component>>
+      m_components;
+  std::multiset<components::BusId> m_unconnectedBuses;
+  std::multiset<components::ComponentId> m_unconnectedComponents;
+  std::multiset<components::ComponentId> m_incompatibleForDC;
+  std::multiset<components::ComponentId> m_incompatibleForAC;
+  std::multiset<components::ComponentId> m_incompatibleForTransient;
+  std::multiset<components::BusId> m_duplicateBuses;
+  std::multiset<components::ComponentId> m_duplicateComponents;
+  uint32_t m_numberOfGrounds;
+  std::unordered_map<components::BusId, uint32_t> m_busIndices;
+  DisjointSet m_busSets;
+  uint32_t m_numberOfDeadSets;
+  components::NeighborScratch m_neighborScratch;
+  bool m_resultOutdated;
+  ValidationResult m_result;
+
+  /// @brief Checks whether a bus object is tracked.
+  /// @param bus The bus.
+  /// @return True if the bus is tracked.
+  bool _isTracked(const components::Bus &bus) const;
+
+  /// @brief Checks whether a component object is tracked.
+  /// @param component The component.
+  /// @return True if the component is tracked.
+  bool _isTracked(const components::Component &component) const;
+
+  /// @brief Returns the union-find index of a tracked bus.
+  /// @param bus The bus.
+  /// @return Index, or NeighborScratch::NO_INDEX if the bus is not tracked.
+  uint32_t _getIndex(const components::Bus &bus) const;
+
+  /// @brief Merges the sets of all tracked buses that a component connects.
+  /// @param component Component whose connections are merged.
+  void _uniteConnections(const components::Component &component);
+
+  /// @brief Collects the tracked buses that a bus reaches through one tracked component.
+  /// @param bus The bus.
+  /// @param busIds Vector the identifiers are appended to.
+  void _collectNeighbors(const components::Bus &bus, std::vector<components::BusId> &busIds);
+
+  /// @brief Splits the set of buses that lost a connection into its connected parts.
+  /// All buses must have been in one set before the removal. Every part but one is given new
+  /// entries in the union-find structure.
+  /// @param busIds Identifiers of the buses that the removed element joined.
+  void _splitConnectivity(const std::vector<components::BusId> &busIds);
+
+  /// @brief Rebuilds the union-find structure once stale entries outnumber the tracked buses.
+  void _compactConnectivity();
+
+  /// @brief Recomputes the union-find structure from the tracked buses and components.
+  void _rebuildConnectivity();
+
+  /// @brief Updates a multiset of erroneous elements after the state of one element changed.
+  /// @param set Multiset to update.
+  /// @param id Identifier of the element.
+  /// @param wasFlagged Whether the element was erroneous before the change.
+  /// @param isFlagged Whether the element is erroneous after the change.
+  static void _updateFlag(std::multiset<uint32_t> &set, uint32_t id, bool wasFlagged,
+                          bool isFlagged);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_INCREMENTAL_VALIDATOR_HPP
@@ -0,0 +1,136 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        lru_cache.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Bounded key-value cache with least recently used eviction.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_LRU_CACHE_HPP
+#define OCIRA_CORE_LRU_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace ocira::core {
+
+/// @brief Hit, miss and eviction counters of a cache.
+struct CacheStatistics {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+};
+
+/// @brief Bounded key-value cache that evicts the least recently used entry.
+/// Lookups and insertions take constant time on average. The cache is not thread safe.
+/// @tparam Key Key type. Must be hashable with std::hash.
+/// @tparam Value Value type. Usually a shared pointer, so that lookups are cheap to copy.
+template <typename Key, typename Value> class LruCache {
+public:
+  /// @brief Constructs an empty cache.
+  /// @param capacity Maximum number of entries. A capacity of zero disables the cache.
+  explicit LruCache(size_t capacity) : m_capacity(capacity) {}
+
+  /// @brief Default destructor.
+  ~LruCache() = default;
+
+  /// @brief Looks up a value and marks it as most recently used.
+  /// @param key Key of the entry.
+  /// @return The value, or an empty optional on a miss.
+  std::optional<Value> find(const Key &key) {
+    auto it = this->m_index.find(key);
+    if (it == this->m_index.end()) {
+      this->m_statistics.misses++;
+      return std::nullopt;
+    }
+
+    this->m_entries.splice(this->m_entries.begin(), this->m_entries, it->second);
+    this->m_statistics.hits++;
+    return it->second->second;
+  }
+
+  /// @brief Inserts or replaces a value and marks it as most recently used.
+  /// The least recently used entry is evicted if the cache is full.
+  /// @param key Key of the entry.
+  /// @param value Value to store.
+  void insert(const Key &key, Value value) {
+    if (this->m_capacity == 0) {
+      return;
+    }
+
+    auto it = this->m_index.find(key);
+    if (it != this->m_index.end()) {
+      it->second->second = std::move(value);
+      this->m_entries.splice(this->m_entries.begin(), this->m_entries, it->second);
+      return;
+    }
+
+    if (this->m_entries.size() == this->m_capacity) {
+      this->m_index.erase(this->m_entries.back().first);
+      this->m_entries.pop_back();
+      this->m_statistics.evictions++;
+    }
+
+    this->m_entries.emplace_front(key, std::move(value));
+    this->m_index.emplace(key, this->m_entries.begin());
+  }
+
+  /// @brief Removes all entries. The statistics are kept.
+  void clear() {
+    this->m_entries.clear();
+    this->m_index.clear();
+  }
+
+  /// @brief Returns the number of entries.
+  /// @return Entry count.
+  size_t getSize() const noexcept { return this->m_entries.size(); }
+
+  /// @brief Returns the maximum number of entries.
+  /// @return Capacity.
+  size_t getCapacity() const noexcept { return this->m_capacity; }
+
+  /// @brief Returns the hit, miss and eviction counters.
+  /// @return Cache statistics.
+  const CacheStatistics &getStatistics() const noexcept { return this->m_statistics; }
+
+private:
+  using Entry = std::pair<Key, Value>;
+
+  size_t m_capacity;
+  std::list<Entry> m_entries; // Most recently used first.
+  std::unordered_map<Key, typename std::list<Entry>::iterator> m_index;
+  CacheStatistics m_statistics;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_LRU_CACHE_HPP
@@ -0,0 +1,222 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        monte_carlo.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Monte Carlo tolerance analysis with online statistics.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Truncate Gaussian deviations by rejection instead of clamping.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_MONTE_CARLO_HPP
+#define OCIRA_CORE_MONTE_CARLO_HPP
+
+#include "bus.hpp"
+#include "component.hpp"
+#include "thread_pool.hpp"
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Distribution of the relative deviation of a component value.
+/// UNIFORM draws from [-tolerance, tolerance]. GAUSSIAN has a standard deviation of a third of
+/// the tolerance and is truncated at the tolerance, so that the tolerance is a 3 sigma limit.
+/// Gaussian draws beyond the tolerance are rejected and drawn again, so no probability mass
+/// collects at the limits.
+enum class ToleranceDistribution { UNIFORM, GAUSSIAN };
+
+/// @brief Tolerance of one component of the circuit.
+/// The primary value of the component (resistance, capacitance, inductance, amperes, volts or
+/// AC amplitude) is multiplied by 1 + deviation in every sample.
+struct ComponentTolerance {
+  components::ComponentId id;
+  double tolerance;
+  ToleranceDistribution distribution = ToleranceDistribution::UNIFORM;
+};
+
+/// @brief Observed quantity of a Monte Carlo analysis: the voltage magnitude of a bus.
+/// A sample passes when the magnitude of every output lies within its limits.
+struct MonteCarloOutput {
+  components::BusId busId;
+  double lowerLimit = -std::numeric_limits<double>::infinity();
+  double upperLimit = std::numeric_limits<double>::infinity();
+};
+
+/// @brief Settings of a Monte Carlo analysis.
+/// The histogram of an output spans its nominal value times 1 -+ histogramSpan, or
+/// -+ histogramSpan if the nominal value is zero.
+struct MonteCarloOptions {
+  uint64_t numberOfSamples = 10000;
+  uint64_t seed = 0;
+  uint32_t histogramBins = 50;
+  double histogramSpan = 0.5;
+};
+
+/// @brief Streaming statistics of a series of values.
+/// Keeps the count, mean, variance (Welford's method), extremes and a fixed-range histogram
+/// without storing the values. Statistics of separate series can be merged, so every thread can
+/// collect its own and combine them at the end.
+class RunningStatistics {
+public:
+  /// @brief Constructs empty statistics.
+  /// Throws std::runtime_error if the range is empty or there are no bins.
+  /// @param lower Lower end of the histogram range.
+  /// @param upper Upper end of the histogram range.
+  /// @param numberOfBins Number of histogram bins.
+  RunningStatistics(double lower, double upper, uint32_t numberOfBins);
+
+  /// @brief Default destructor.
+  ~RunningStatistics() = default;
+
+  /// @brief Adds a value.
+  /// @param value Value to add.
+  void add(double value) noexcept;
+
+  /// @brief Adds the values of other statistics.
+  /// Throws std::runtime_error if the histograms differ in range or bins.
+  /// @param other Statistics to merge.
+  void merge(const RunningStatistics &other);
+
+  /// @brief Returns the number of values.
+  /// @return Value count.
+  uint64_t getCount() const noexcept;
+
+  /// @brief Returns the mean of the values. Zero without values.
+  /// @return Mean.
+  double getMean() const noexcept;
+
+  /// @brief Returns the sample variance of the values. Zero with fewer than two values.
+  /// @return Variance.
+  double getVariance() const noexcept;
+
+  /// @brief Returns the sample standard deviation of the values.
+  /// @return Standard deviation.
+  double getStandardDeviation() const noexcept;
+
+  /// @brief Returns the smallest value. Infinity without values.
+  /// @return Minimum.
+  double getMinimum() const noexcept;
+
+  /// @brief Returns the largest value. Minus infinity without values.
+  /// @return Maximum.
+  double getMaximum() const noexcept;
+
+  /// @brief Returns the lower end of the histogram range.
+  /// @return Lower end.
+  double getHistogramLower() const noexcept;
+
+  /// @brief Returns the upper end of the histogram range.
+  /// @return Upper end.
+  double getHistogramUpper() const noexcept;
+
+  /// @brief Returns the histogram. Bin k counts the values in [lower + k * w, lower + (k + 1) * w)
+  /// with w = (upper - lower) / bins. The upper end belongs to the last bin.
+  /// @return Const reference to the bin counts.
+  const std::vector<uint64_t> &getHistogram() const noexcept;
+
+  /// @brief Returns the number of values below the histogram range.
+  /// @return Underflow count.
+  uint64_t getUnderflow() const noexcept;
+
+  /// @brief Returns the number of values above the histogram range, or that are not a number.
+  /// @return Overflow count.
+  uint64_t getOverflow() const noexcept;
+
+private:
+  uint64_t m_count;
+  double m_mean;
+  double m_sumOfSquares; // Sum of squared deviations from the mean.
+  double m_minimum;
+  double m_maximum;
+  double m_lower;
+  double m_upper;
+  std::vector<uint64_t> m_histogram;
+  uint64_t m_underflow;
+  uint64_t m_overflow;
+};
+
+/// @brief Result of a Monte Carlo analysis.
+/// statistics holds one entry per output, in the order of the outputs. Samples whose system is
+/// singular count as failed: they fail the yield and do not enter the statistics.
+struct MonteCarloResult {
+  uint64_t numberOfSamples;
+  uint64_t numberOfPassedSamples;
+  uint64_t numberOfFailedSamples;
+  double yield;
+  std::vector<double> nominalValues;
+  std::vector<RunningStatistics> statistics;
+};
+
+/// @brief Provides static methods for Monte Carlo analysis of DC and AC circuits.
+/// The circuit is transformed once. Each sample copies the nominal admittance matrix and current
+/// vector, adds the change of every toleranced component to the entries that component stamps,
+/// and factorizes and solves the result. Bus numbering, validation and the entries of the other
+/// components are shared by all samples. The random deviations are a hash of the seed, the sample
+/// index and the tolerance index, so every sample is reproducible and independent of how the
+/// samples are spread over threads. Only components at the top level of the circuit can have
+/// tolerances, as subcircuit definitions are shared by their instances.
+/// This class cannot be instantiated.
+class MonteCarlo {
+public:
+  /// @brief Make the class non-instantiable.
+  MonteCarlo() = delete;
+
+  /// @brief Runs a Monte Carlo analysis on the threads of a pool.
+  /// Throws std::runtime_error if the circuit is a transient circuit or not valid, if a tolerance
+  /// refers to an unknown component, a component without a value or is not in [0, 1), if an
+  /// output refers to an unknown bus, if the options are not valid or if the nominal system is
+  /// singular.
+  /// @param circuit Circuit to analyse. It must not be edited during the analysis.
+  /// @param tolerances Component tolerances. A component must not appear twice.
+  /// @param outputs Observed bus voltages, at least one.
+  /// @param options Settings of the analysis.
+  /// @param pool Thread pool that solves the samples.
+  /// @return Yield and statistics of the outputs.
+  static MonteCarloResult run(const std::shared_ptr<const Circuit> &circuit,
+                              const std::vector<ComponentTolerance> &tolerances,
+                              const std::vector<MonteCarloOutput> &outputs,
+                              const MonteCarloOptions &options, ThreadPool &pool);
+
+  /// @brief Returns the relative deviation that a sample draws for a tolerance.
+  /// @param seed Seed of the analysis.
+  /// @param sample Index of the sample.
+  /// @param index Index of the tolerance.
+  /// @param tolerance Tolerance.
+  /// @return Deviation in [-tolerance.tolerance, tolerance.tolerance].
+  static double getDeviation(uint64_t seed, uint64_t sample, uint64_t index,
+                             const ComponentTolerance &tolerance) noexcept;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_MONTE_CARLO_HPP
@@ -0,0 +1,113 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        network_parameters.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Z, Y and S parameters of a circuit seen as a multiport.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+#ifndef OCIRA_CORE_NETWORK_PARAMETERS_HPP
+#define OCIRA_CORE_NETWORK_PARAMETERS_HPP
+
+#include "circuit_enums.hpp"
+#include "circuit_structs.hpp"
+#include "thread_pool.hpp"
+#include <armadillo>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+class CircuitSnapshot;
+
+/// @brief Network parameters of a multiport at a list of frequencies.
+/// Column k of parameters holds the N x N parameter matrix at frequencies[k] in column-major
+/// order, so entry (i, j) of the matrix is parameters(i + j * N, k) and every matrix is
+/// contiguous in memory. For two ports that is the N11 N21 N12 N22 order of Touchstone files.
+/// ports are the ports of the circuit, port number i + 1 being ports[i].
+struct NetworkParameterResult {
+  NetworkParameterType type;
+  std::vector<Port> ports;
+  std::vector<float> frequencies;
+  arma::cx_mat parameters;
+};
+
+/// @brief Provides static methods for extracting the network parameters of AC circuits.
+/// At each frequency the circuit is transformed and factorized once, and a unit current is
+/// injected at every port, entering at its positive bus and leaving at its negative bus, with
+/// all independent sources zeroed. The N excitations are solved as one block, and the port
+/// voltages of excitation j form column j of the impedance matrix Z. The admittance matrix is
+/// Z^-1 and the scattering matrix is (Zn - I) * (Zn + I)^-1 with Zn = R^-1/2 * Z * R^-1/2 and
+/// R the diagonal matrix of the reference impedances. Frequencies are spread over the threads
+/// of a pool. The circuit is never modified.
+/// This class cannot be instantiated.
+class NetworkParameters {
+public:
+  /// @brief Make the class non-instantiable.
+  NetworkParameters() = delete;
+
+  /// @brief Computes the parameters of the ports of a circuit, using the threads of a pool.
+  /// Throws std::runtime_error if the circuit is not an AC circuit, is not valid or singular
+  /// with all ports open, if it has no ports, if a port bus is not part of the circuit, a port
+  /// repeats the same bus or has a reference impedance that is not positive, if the frequency
+  /// list is empty, or if admittance parameters are asked for and Z is singular.
+  /// @param circuit Circuit to characterize. It must not be edited during the analysis.
+  /// @param frequencies Frequencies in hertz, in any order.
+  /// @param type Kind of parameters.
+  /// @param pool Thread pool that solves the frequencies.
+  /// @return Parameters in the order of the frequencies.
+  static NetworkParameterResult compute(const std::shared_ptr<const Circuit> &circuit,
+                                        const std::vector<float> &frequencies,
+                                        NetworkParameterType type, ThreadPool &pool);
+
+  /// @brief Computes the parameters of the ports of a circuit on a temporary thread pool.
+  /// @param circuit Circuit to characterize. It must not be edited during the analysis.
+  /// @param frequencies Frequencies in hertz, in any order.
+  /// @param type Kind of parameters.
+  /// @param numberOfThreads Number of threads. Zero selects the number of hardware threads.
+  /// @return Parameters in the order of the frequencies.
+  static NetworkParameterResult compute(const std::shared_ptr<const Circuit> &circuit,
+                                        const std::vector<float> &frequencies,
+                                        NetworkParameterType type,
+                                        uint32_t numberOfThreads = 0);
+
+private:
+  /// @brief Computes the parameter matrix at one frequency.
+  /// @param base Snapshot of the circuit.
+  /// @param frequency Frequency in hertz.
+  /// @param type Kind of parameters.
+  /// @return N x N parameter matrix.
+  static arma::cx_mat _computePoint(const CircuitSnapshot &base, float frequency,
+                                    NetworkParameterType type);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_NETWORK_PARAMETERS_HPP
@@ -0,0 +1,112 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        nonlinear_solver.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Newton-Raphson DC solver for circuits with diodes.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_NONLINEAR_SOLVER_HPP
+#define OCIRA_CORE_NONLINEAR_SOLVER_HPP
+
+#include "bus.hpp"
+#include "circuit_transformer.hpp"
+#include "component.hpp"
+#include <armadillo>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Settings of the Newton-Raphson iteration.
+/// The iteration has converged when every unknown moved by at most
+/// relativeTolerance * |value| + absoluteTolerance (volts for buses, amperes for voltage source
+/// currents) in a full Newton step, and the current of every diode matches its linearization
+/// within relativeTolerance * |current| + currentTolerance. A diode whose junction voltage moved
+/// by less than bypassTolerance since it was last evaluated keeps its previous linearization.
+struct NewtonOptions {
+  uint32_t maxIterations = 100;
+  double relativeTolerance = 1e-6;
+  double absoluteTolerance = 1e-9;
+  double currentTolerance = 1e-12;
+  double bypassTolerance = 1e-10;
+};
+
+/// @brief Operating point of a nonlinear circuit.
+/// solution is laid out like the solutions of CircuitCalculator, with the bus numbers of
+/// busIdMap. diodeCurrents holds the current from anode to cathode of every diode, in the order
+/// of diodeIds. numberOfEvaluations counts the diode evaluations, numberOfBypasses the skipped
+/// ones and numberOfFactorizations the LU factorizations.
+struct NewtonResult {
+  arma::vec solution;
+  std::unordered_map<components::BusId, BusNumber> busIdMap;
+  std::vector<components::ComponentId> diodeIds;
+  std::vector<double> diodeCurrents;
+  uint32_t iterations;
+  uint64_t numberOfEvaluations;
+  uint64_t numberOfBypasses;
+  uint64_t numberOfFactorizations;
+  bool converged;
+};
+
+/// @brief Provides static methods for solving DC circuits with diodes.
+/// The linear part of the circuit is transformed once. Each diode is replaced by its Newton
+/// companion model, the conductance g = dI / dV at the current junction voltage in parallel with
+/// the current source I - g * V. Every iteration only restamps the diodes that were evaluated
+/// again, by adding the change of their entries to the system, and only refactorizes if any
+/// entry changed. Steps are damped so that a junction voltage in the exponential region grows
+/// logarithmically, as in SPICE's junction limiting, which keeps the exponential from
+/// overflowing on the first iterations. Every diode has a conductance of 1e-12 S in parallel, so
+/// buses that only connect through reverse biased diodes do not make the system singular.
+/// This class cannot be instantiated.
+class NonlinearSolver {
+public:
+  /// @brief Make the class non-instantiable.
+  NonlinearSolver() = delete;
+
+  /// @brief Minimum conductance in parallel with every diode, in siemens.
+  static constexpr double MINIMUM_CONDUCTANCE = 1e-12;
+
+  /// @brief Computes the DC operating point of a circuit.
+  /// Starts with all junction voltages at zero. Throws std::runtime_error if the circuit is not
+  /// a valid DC circuit, if the options are not valid or if the system is singular.
+  /// @param circuit Circuit to solve.
+  /// @param options Settings of the iteration.
+  /// @return Operating point. converged is false if maxIterations was reached first.
+  static NewtonResult solve(const std::shared_ptr<const Circuit> &circuit,
+                            const NewtonOptions &options = NewtonOptions());
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_NONLINEAR_SOLVER_HPP
@@ -0,0 +1,88 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        sensitivity_analysis.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Adjoint sensitivities of bus voltages to component values.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_SENSITIVITY_ANALYSIS_HPP
+#define OCIRA_CORE_SENSITIVITY_ANALYSIS_HPP
+
+#include "bus.hpp"
+#include "component.hpp"
+#include <armadillo>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Derivatives of bus voltages with respect to component values.
+/// componentIds lists every resistor, capacitor, inductor and source at the top level of the
+/// circuit, in the order of Circuit::getComponents. The parameter of a component is its primary
+/// value, as in ComponentOverride: resistance, capacitance, inductance, amperes, volts or AC
+/// amplitude. Row k of the matrices belongs to busIds[k] and column m to componentIds[m].
+/// sensitivities holds the derivatives of the complex bus voltages, magnitudeSensitivities those
+/// of their magnitudes, which are zero for buses at zero volts.
+struct SensitivityResult {
+  std::vector<components::BusId> busIds;
+  std::vector<components::ComponentId> componentIds;
+  arma::cx_vec voltages;
+  arma::cx_mat sensitivities;
+  arma::mat magnitudeSensitivities;
+};
+
+/// @brief Provides static methods for adjoint sensitivity analysis of DC and AC circuits.
+/// For an output v_k = e_k^T * x of the system Y * x = J, the adjoint solution lambda of
+/// Y^T * lambda = e_k gives dv_k / dp = lambda^T * (dJ / dp - dY / dp * x) for every parameter p.
+/// Each component only touches a few entries of Y and J, so all derivatives of one output cost
+/// one transposed solve with the factorization of Y and O(1) work per component. The whole
+/// analysis costs one factorization, one forward solve and one transposed solve per output,
+/// however many components the circuit has.
+/// This class cannot be instantiated.
+class SensitivityAnalysis {
+public:
+  /// @brief Make the class non-instantiable.
+  SensitivityAnalysis() = delete;
+
+  /// @brief Computes the sensitivities of bus voltages to all component values.
+  /// Throws std::runtime_error if the circuit is a transient circuit, is not valid or singular,
+  /// or if a bus ID is not part of the circuit.
+  /// @param circuit Circuit to analyse.
+  /// @param busIds Buses whose voltages are differentiated.
+  /// @return Voltages and their derivatives.
+  static SensitivityResult compute(const std::shared_ptr<const Circuit> &circuit,
+                                   const std::vector<components::BusId> &busIds);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_SENSITIVITY_ANALYSIS_HPP
@@ -0,0 +1,96 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        solution_cache.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: In-process cache of factorizations and solutions keyed by fingerprint.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_SOLUTION_CACHE_HPP
+#define OCIRA_CORE_SOLUTION_CACHE_HPP
+
+#include "circuit_factorization.hpp"
+#include "circuit_fingerprint.hpp"
+#include "factorization_store.hpp"
+#include "lru_cache.hpp"
+#include <armadillo>
+#include <memory>
+#include <mutex>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Bounded in-process cache of factorizations and solutions.
+/// Solutions are keyed by the full fingerprint of a circuit, factorizations by its admittance
+/// fingerprint. A repeated circuit is answered from the solution cache without validation,
+/// transformation or solving. A circuit that differs only in source values reuses the cached
+/// factorization and costs one transformation and two triangular solves. Both caches use LRU
+/// eviction. An optional FactorizationStore extends the factorization cache to disk, so a
+/// restarted process loads factorizations instead of recomputing them. All methods are thread
+/// safe.
+class SolutionCache {
+public:
+  /// @brief Constructs an empty cache.
+  /// @param solutionCapacity Maximum number of cached solutions.
+  /// @param factorizationCapacity Maximum number of cached factorizations.
+  /// @param store Optional on-disk store, consulted on factorization misses.
+  SolutionCache(size_t solutionCapacity, size_t factorizationCapacity,
+                std::shared_ptr<const FactorizationStore> store = nullptr);
+
+  /// @brief Default destructor.
+  ~SolutionCache() = default;
+
+  /// @brief Solves a circuit, using cached results where possible.
+  /// Throws std::runtime_error if the circuit is not valid.
+  /// @param circuit Circuit to solve.
+  /// @return Shared pointer to the solution vector, as returned by CircuitCalculator.
+  std::shared_ptr<const arma::cx_vec> solve(const std::shared_ptr<Circuit> &circuit);
+
+  /// @brief Returns the statistics of the solution cache.
+  /// @return Copy of the solution cache statistics.
+  CacheStatistics getSolutionStatistics() const;
+
+  /// @brief Returns the statistics of the factorization cache.
+  /// @return Copy of the factorization cache statistics.
+  CacheStatistics getFactorizationStatistics() const;
+
+  /// @brief Removes all cached solutions and factorizations.
+  void clear();
+
+private:
+  mutable std::mutex m_mutex;
+  LruCache<uint64_t, std::shared_ptr<const arma::cx_vec>> m_solutions;
+  LruCache<uint64_t, std::shared_ptr<const CircuitFactorization>> m_factorizations;
+  std::shared_ptr<const FactorizationStore> m_store;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_SOLUTION_CACHE_HPP
@@ -0,0 +1,144 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        subcircuit.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Reusable subcircuit definitions and their instances.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_SUBCIRCUIT_HPP
+#define OCIRA_CORE_SUBCIRCUIT_HPP
+
+#include "bus.hpp"
+#include "component.hpp"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ocira::core {
+
+/// @brief Unique identifier for a subcircuit instance in a circuit.
+using SubcircuitInstanceId = uint32_t;
+
+/// @brief A reusable cell such as a filter stage or a cable segment.
+/// The definition owns its own buses and components. Some of its buses are exposed as ports,
+/// which instances map onto buses of the parent circuit. All other buses are internal and get
+/// separate nodes for every instance. Definitions may contain resistors, capacitors, inductors,
+/// current sources and wires. Ground and voltage sources belong in the parent circuit.
+class SubcircuitDefinition {
+public:
+  /// @brief Constructs a definition from its buses, components and ports.
+  /// Throws std::runtime_error if a port is not one of the buses, if a component is not fully
+  /// connected to buses of the definition or if a component type is not supported.
+  /// @param buses Buses of the definition, including the port buses.
+  /// @param components Components of the definition.
+  /// @param ports Bus IDs of the port buses, in port order.
+  SubcircuitDefinition(std::vector<std::shared_ptr<components::Bus>> buses,
+                       std::vector<std::shared_ptr<components::Component>> components,
+                       std::vector<components::BusId> ports);
+
+  /// @brief Default destructor.
+  ~SubcircuitDefinition() = default;
+
+  /// @brief Returns the buses of the definition.
+  /// @return Const reference to the vector of buses.
+  const std::vector<std::shared_ptr<components::Bus>> &getBuses() const;
+
+  /// @brief Returns the components of the definition.
+  /// @return Const reference to the vector of components.
+  const std::vector<std::shared_ptr<components::Component>> &getComponents() const;
+
+  /// @brief Returns the bus IDs of the ports, in port order.
+  /// @return Const reference to the vector of port bus IDs.
+  const std::vector<components::BusId> &getPorts() const;
+
+  /// @brief Returns the number of ports.
+  /// @return Port count.
+  uint32_t getNumberOfPorts() const noexcept;
+
+  /// @brief Returns the number of internal (non-port) buses.
+  /// @return Internal bus count.
+  uint32_t getNumberOfInternalBuses() const noexcept;
+
+  /// @brief Returns the local index of a bus. Ports come first in port order, internal buses
+  /// follow in the order they were given.
+  /// @param id Bus ID within the definition.
+  /// @return Local index of the bus.
+  uint32_t getLocalIndex(components::BusId id) const;
+
+  /// @brief Returns, for each port, a label of the connected part of the definition it belongs
+  /// to. Ports with the same label are connected to each other through the definition.
+  /// @return Const reference to the vector of labels, in port order.
+  const std::vector<uint32_t> &getPortGroups() const;
+
+private:
+  std::vector<std::shared_ptr<components::Bus>> m_buses;
+  std::vector<std::shared_ptr<components::Component>> m_components;
+  std::vector<components::BusId> m_ports;
+  std::unordered_map<components::BusId, uint32_t> m_localIndices;
+  std::vector<uint32_t> m_portGroups;
+};
+
+/// @brief A placement of a subcircuit definition in a circuit.
+/// The instance only stores which parent buses its ports are connected to. The definition is
+/// shared by all of its instances.
+class SubcircuitInstance {
+public:
+  /// @brief Constructs an instance of a definition.
+  /// Throws std::runtime_error if the number of port buses does not match the definition.
+  /// @param id Unique identifier for the instance.
+  /// @param definition Shared pointer to the definition.
+  /// @param portBuses Parent circuit bus IDs, one for each port of the definition.
+  SubcircuitInstance(SubcircuitInstanceId id,
+                     std::shared_ptr<const SubcircuitDefinition> definition,
+                     std::vector<components::BusId> portBuses);
+
+  /// @brief Default destructor.
+  ~SubcircuitInstance() = default;
+
+  /// @brief Retrieves the unique identifier of the instance.
+  /// @return Instance ID.
+  SubcircuitInstanceId getId() const noexcept;
+
+  /// @brief Returns the definition of the instance.
+  /// @return Shared pointer to the definition.
+  const std::shared_ptr<const SubcircuitDefinition> &getDefinition() const noexcept;
+
+  /// @brief Returns the parent circuit bus IDs connected to the ports, in port order.
+  /// @return Const reference to the vector of bus IDs.
+  const std::vector<components::BusId> &getPortBuses() const;
+
+private:
+  SubcircuitInstanceId m_id;
+  std::shared_ptr<const SubcircuitDefinition> m_definition;
+  std::vector<components::BusId> m_portBuses;
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_SUBCIRCUIT_HPP
@@ -0,0 +1,91 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        superposition_analysis.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Contributions of every independent source to the bus voltages.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+#ifndef OCIRA_CORE_SUPERPOSITION_ANALYSIS_HPP
+#define OCIRA_CORE_SUPERPOSITION_ANALYSIS_HPP
+
+#include "bus.hpp"
+#include "component.hpp"
+#include <armadillo>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Contributions of the independent sources to bus voltages.
+/// sourceIds lists every voltage and current source of the circuit, in the order of
+/// Circuit::getComponents. Entry (m, k) of contributions is the voltage of busIds[k] with
+/// sourceIds[m] at its value and all other sources zeroed, that is voltage sources shorted and
+/// current sources opened. The sum of column k is the voltage of busIds[k] with all sources.
+struct SuperpositionResult {
+  std::vector<components::ComponentId> sourceIds;
+  std::vector<components::BusId> busIds;
+  arma::cx_mat contributions;
+};
+
+/// @brief Provides static methods for superposition analysis of DC and AC circuits.
+/// Sources only enter the right-hand side J of Y * x = J, so the system is factorized once and
+/// the right-hand side of each source, which has one or two non-zero entries, is solved as one
+/// block of forward and back substitutions. If fewer buses are requested than there are
+/// sources, the contributions are instead read from one transposed solve per bus: with
+/// Y^T * lambda = e_k, the contribution of a source to bus k is lambda^T * J_source. The circuit
+/// is never modified.
+/// This class cannot be instantiated.
+class SuperpositionAnalysis {
+public:
+  /// @brief Make the class non-instantiable.
+  SuperpositionAnalysis() = delete;
+
+  /// @brief Computes the contributions of all sources to all buses.
+  /// Buses are listed in the order of Circuit::getBuses.
+  /// Throws std::runtime_error if the circuit is a transient circuit, is not valid or singular,
+  /// or has subcircuit instances, whose sources are stamped as part of their definition.
+  /// @param circuit Circuit to analyse.
+  /// @return Contributions, one row per source and one column per bus.
+  static SuperpositionResult compute(const std::shared_ptr<const Circuit> &circuit);
+
+  /// @brief Computes the contributions of all sources to the given buses.
+  /// Throws std::runtime_error as the overload for all buses does, or if a bus ID is not part
+  /// of the circuit.
+  /// @param circuit Circuit to analyse.
+  /// @param busIds Buses whose voltages are decomposed.
+  /// @return Contributions, one row per source and one column per bus.
+  static SuperpositionResult compute(const std::shared_ptr<const Circuit> &circuit,
+                                     const std::vector<components::BusId> &busIds);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_SUPERPOSITION_ANALYSIS_HPP
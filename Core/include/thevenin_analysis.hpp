@@ -0,0 +1,94 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        thevenin_analysis.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Thevenin and Norton equivalents seen between pairs of buses.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Treat ground pairs and pairs across voltage sources as shorts.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+#ifndef OCIRA_CORE_THEVENIN_ANALYSIS_HPP
+#define OCIRA_CORE_THEVENIN_ANALYSIS_HPP
+
+#include "bus.hpp"
+#include "component.hpp"
+#include <armadillo>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Two buses the circuit is seen from, with the voltage measured from positive to
+/// negative.
+struct BusPair {
+  components::BusId positive;
+  components::BusId negative;
+};
+
+/// @brief Thevenin and Norton equivalents of a circuit, entry k belonging to pairs[k].
+/// The Thevenin source has the open-circuit voltage in series with the impedance, the Norton
+/// source drives the short-circuit current, from positive to negative through the short, into
+/// the admittance. A pair of buses that are connected by a voltage source or are both ground
+/// has zero impedance and an infinite Norton current and admittance. Impedances below 1e-12 of
+/// the largest response to the unit injections count as zero.
+struct TheveninResult {
+  std::vector<BusPair> pairs;
+  arma::cx_vec theveninVoltages;
+  arma::cx_vec theveninImpedances;
+  arma::cx_vec nortonCurrents;
+  arma::cx_vec nortonAdmittances;
+};
+
+/// @brief Provides static methods for extracting Thevenin and Norton equivalents of DC and AC
+/// circuits.
+/// The open-circuit voltage of a pair follows from the solution of Y * x = J. The impedance is
+/// the voltage that a unit current injected at the positive bus and drawn from the negative bus
+/// causes with all sources zeroed. Zeroing the sources only clears J, so the matrix is the same
+/// and the circuit is factorized once. The solution and the unit injections of all pairs are
+/// solved as one block of forward and back substitutions. The circuit is never modified.
+/// This class cannot be instantiated.
+class TheveninAnalysis {
+public:
+  /// @brief Make the class non-instantiable.
+  TheveninAnalysis() = delete;
+
+  /// @brief Computes the equivalents seen at pairs of buses.
+  /// Throws std::runtime_error if the circuit is a transient circuit, is not valid or singular,
+  /// or if a bus ID is not part of the circuit or a pair repeats the same bus.
+  /// @param circuit Circuit to analyse.
+  /// @param pairs Bus pairs.
+  /// @return Equivalents of every pair.
+  static TheveninResult compute(const std::shared_ptr<const Circuit> &circuit,
+                                const std::vector<BusPair> &pairs);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_THEVENIN_ANALYSIS_HPP
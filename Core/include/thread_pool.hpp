@@ -0,0 +1,99 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        thread_pool.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Fixed-size pool of worker threads.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Split batches into contiguous ranges.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_THREAD_POOL_HPP
+#define OCIRA_CORE_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ocira::core {
+
+/// @brief Fixed-size pool of worker threads.
+/// Work is handed to the pool as a batch of numbered tasks. The calling thread blocks until the
+/// whole batch has finished, so tasks can safely refer to local variables of the caller.
+class ThreadPool {
+public:
+  /// @brief Starts the worker threads.
+  /// @param numberOfThreads Number of workers. Zero selects the number of hardware threads.
+  explicit ThreadPool(uint32_t numberOfThreads = 0);
+
+  /// @brief Finishes the queued work and joins the worker threads.
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// @brief Returns the number of worker threads.
+  /// @return Thread count.
+  uint32_t getNumberOfThreads() const noexcept;
+
+  /// @brief Runs task(0) .. task(numberOfTasks - 1) on the workers and waits for all of them.
+  /// If tasks throw, the remaining tasks still run and the first exception is rethrown here.
+  /// @param numberOfTasks Number of tasks in the batch.
+  /// @param task Function called with the task index.
+  void run(size_t numberOfTasks, const std::function<void(size_t)> &task);
+
+  /// @brief Returns the number of ranges runRanges splits a batch of items into.
+  /// @param numberOfItems Number of items in the batch.
+  /// @return One range per thread, but no more ranges than items.
+  size_t getNumberOfRanges(size_t numberOfItems) const noexcept;
+
+  /// @brief Splits items 0 .. numberOfItems - 1 into contiguous ranges of nearly equal size and
+  /// runs range(task, begin, end) for each of them as one task, waiting for all of them.
+  /// Tasks that write to their own items or to per-task state need no locking.
+  /// @param numberOfItems Number of items in the batch.
+  /// @param range Function called with the task index and the half-open item range.
+  void runRanges(size_t numberOfItems,
+                 const std::function<void(size_t, size_t, size_t)> &range);
+
+private:
+  std::vector<std::thread> m_workers;
+  std::queue<std::function<void()>> m_queue;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_stopping;
+
+  /// @brief Main loop of a worker thread.
+  void _work();
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_THREAD_POOL_HPP
@@ -0,0 +1,235 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        transient_analysis.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Time-domain analysis with companion models of capacitors and inductors.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_TRANSIENT_ANALYSIS_HPP
+#define OCIRA_CORE_TRANSIENT_ANALYSIS_HPP
+
+#include "bus.hpp"
+#include "circuit_enums.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_transformer.hpp"
+#include "lru_cache.hpp"
+#include <armadillo>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Settings of a fixed-step transient run.
+struct TransientOptions {
+  double timeStep = 1e-6;
+  double stopTime = 1e-3;
+  IntegrationMethod method = IntegrationMethod::TRAPEZOIDAL;
+};
+
+/// @brief Settings of a variable-step transient run.
+/// Steps are initialStep times a power of two, between minStep and maxStep, so that only a few
+/// distinct step sizes occur and their factorizations can be cached. A step is accepted when the
+/// estimated local truncation error of every capacitor voltage and inductor current is below
+/// relativeTolerance * |value| + absoluteTolerance.
+struct AdaptiveTransientOptions {
+  double initialStep = 1e-9;
+  double minStep = 1e-15;
+  double maxStep = 1e-3;
+  double stopTime = 1e-3;
+  double relativeTolerance = 1e-3;
+  double absoluteTolerance = 1e-6;
+  IntegrationMethod method = IntegrationMethod::TRAPEZOIDAL;
+  size_t factorizationCacheSize = 8;
+};
+
+/// @brief Solutions of a transient run.
+/// Column k of solutions is the solution vector at times[k], laid out like the solutions of
+/// CircuitCalculator: bus voltages first, then the currents of the voltage sources.
+struct TransientResult {
+  std::vector<double> times;
+  arma::mat solutions;
+  uint64_t numberOfRejectedSteps = 0;
+  uint64_t numberOfFactorizations = 0;
+};
+
+/// @brief Time-domain solver for circuits in SimulationMode::TRANSIENT.
+/// Capacitors and inductors are replaced by companion models, a conductance in parallel with a
+/// history current source. The conductances only depend on the timestep, so the system matrix is
+/// factorized when the step changes and every other step only rebuilds the right-hand side and
+/// performs two triangular solves. Factorizations of recently used steps are kept in a small
+/// cache. DC sources are constant, AC sources follow amplitude * cos(2 * pi * f * t + phase) at
+/// the circuit frequency. The run starts at t = 0 with discharged capacitors and currentless
+/// inductors. The trapezoidal rule starts with two backward Euler half steps, which use the same
+/// conductances, so that no inconsistent initial current makes it ring.
+class TransientAnalysis {
+public:
+  /// @brief Validates the circuit, builds the companion system and factorizes it.
+  /// Throws std::runtime_error if the circuit is not a valid transient circuit, if the timestep
+  /// is not positive or if the system is singular.
+  /// @param circuit Circuit to simulate. It must not be edited during the analysis.
+  /// @param timeStep Timestep in seconds.
+  /// @param method Integration method.
+  /// @param factorizationCacheSize Number of factorizations kept for reuse, at least one.
+  TransientAnalysis(const std::shared_ptr<const Circuit> &circuit, double timeStep,
+                    IntegrationMethod method = IntegrationMethod::TRAPEZOIDAL,
+                    size_t factorizationCacheSize = 1);
+
+  /// @brief Default destructor.
+  ~TransientAnalysis() = default;
+
+  /// @brief Advances the analysis by one timestep.
+  void step();
+
+  /// @brief Changes the timestep of the following steps.
+  /// The system is refactorized on the next step unless the cache holds the factorization.
+  /// Throws std::runtime_error if the timestep is not positive.
+  /// @param timeStep Timestep in seconds.
+  void setTimeStep(double timeStep);
+
+  /// @brief Returns the current timestep.
+  /// @return Timestep in seconds.
+  double getTimeStep() const noexcept;
+
+  /// @brief Returns the time of the current solution.
+  /// @return Time in seconds.
+  double getTime() const noexcept;
+
+  /// @brief Returns the number of steps taken so far.
+  /// @return Step count.
+  uint64_t getNumberOfSteps() const noexcept;
+
+  /// @brief Returns the number of factorizations computed so far.
+  /// @return Factorization count.
+  uint64_t getNumberOfFactorizations() const noexcept;
+
+  /// @brief Returns the solution at the current time. All zeros before the first step.
+  /// @return Const reference to the solution vector.
+  const arma::vec &getSolution() const noexcept;
+
+  /// @brief Maps circuit bus IDs to matrix bus numbers, numbered as by CircuitTransformer.
+  /// @return Reference to the bus ID → bus number mapping.
+  const std::unordered_map<components::BusId, BusNumber> &getBusIdMap() const noexcept;
+
+  /// @brief Runs a fixed-step analysis from t = 0 to the stop time.
+  /// Throws std::runtime_error as the constructor does, or if the stop time is not positive.
+  /// @param circuit Circuit to simulate.
+  /// @param options Settings of the run.
+  /// @return Solutions after every step, starting at t = timeStep.
+  static TransientResult run(const std::shared_ptr<const Circuit> &circuit,
+                             const TransientOptions &options);
+
+  /// @brief Runs a variable-step analysis from t = 0 to the stop time.
+  /// The local truncation error is estimated from divided differences of the capacitor voltages
+  /// and inductor currents at the last accepted steps. Steps that miss the tolerance are
+  /// repeated with half the step, steps well within it double the next step. The last step is
+  /// shortened to end at the stop time. Throws std::runtime_error as the constructor does, if
+  /// the options are not valid or if the tolerance cannot be met with the minimum step.
+  /// @param circuit Circuit to simulate.
+  /// @param options Settings of the run.
+  /// @return Solutions after every accepted step, with step and factorization counts.
+  static TransientResult runAdaptive(const std::shared_ptr<const Circuit> &circuit,
+                                     const AdaptiveTransientOptions &options);
+
+private:
+  /// @brief A capacitor or inductor. Nodes are bus numbers, current flows from the first node
+  /// to the second one.
+  struct ReactiveBranch {
+    BusNumber first;
+    BusNumber second;
+    bool isInductor;
+    double value;
+  };
+
+  /// @brief An independent source and the right-hand side entries it drives.
+  struct TransientSource {
+    double amplitude;
+    double phase;
+    bool isAlternating;
+    std::vector<std::pair<arma::uword, double>> entries;
+  };
+
+  /// @brief Everything a step changes, so that a rejected step can be undone by a copy.
+  /// Times are counted from the start of the current run of equal steps, which keeps them on
+  /// the step grid instead of accumulating rounding errors.
+  struct IntegrationState {
+    double segmentStart;
+    uint64_t segmentSteps;
+    double time;
+    uint64_t numberOfSteps;
+    arma::vec solution;
+    std::vector<double> voltages;
+    std::vector<double> currents;
+  };
+
+  uint32_t m_sizeG;
+  double m_timeStep;
+  double m_angularFrequency;
+  IntegrationMethod m_method;
+  uint64_t m_numberOfFactorizations;
+  IntegrationState m_state;
+  std::unordered_map<components::BusId, BusNumber> m_busIdMap;
+  std::vector<ReactiveBranch> m_reactiveBranches;
+  std::vector<TransientSource> m_sources;
+  arma::cx_mat m_baseMatrix;
+  LruCache<double, std::shared_ptr<const CircuitFactorization>> m_factorizations;
+
+  /// @brief Adds a two-terminal component to the base matrix or the source list.
+  /// @param component Component to add.
+  /// @param first Bus number of the first connection.
+  /// @param second Bus number of the second connection.
+  void _addComponent(const components::Component &component, BusNumber first, BusNumber second);
+
+  /// @brief Returns the companion conductance of a reactive branch.
+  /// Capacitors get C / h and inductors h / L, where the effective step h is the step for
+  /// backward Euler and half the step for the trapezoidal rule.
+  /// @param branch Reactive branch.
+  /// @param effectiveStep Effective step in seconds.
+  /// @return Conductance in siemens.
+  static double _getConductance(const ReactiveBranch &branch, double effectiveStep) noexcept;
+
+  /// @brief Returns the factorization for an effective step, from the cache or newly computed.
+  /// @param effectiveStep Effective step in seconds.
+  /// @return Shared pointer to the factorization.
+  std::shared_ptr<const CircuitFactorization> _getFactorization(double effectiveStep);
+
+  /// @brief Solves the system at time + dt with the given method and updates the state.
+  /// @param dt Length of the step in seconds.
+  /// @param method Integration method used for the history sources.
+  void _advance(double dt, IntegrationMethod method);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_TRANSIENT_ANALYSIS_HPP
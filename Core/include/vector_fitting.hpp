@@ -0,0 +1,169 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        vector_fitting.hpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Rational pole-residue macromodels of frequency responses.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#ifndef OCIRA_CORE_VECTOR_FITTING_HPP
+#define OCIRA_CORE_VECTOR_FITTING_HPP
+
+#include "bus.hpp"
+#include "frequency_sweep.hpp"
+#include <armadillo>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ocira::core {
+
+// Forward declarations.
+class Circuit;
+
+/// @brief Pole-residue model of several frequency responses with common poles,
+/// H_m(s) = sum_n residues(m, n) / (s - poles(n)) + constants(m), where s = j * 2 * pi * f.
+/// Complex poles come in conjugate pairs with conjugate residues, so the model describes a
+/// real system. Evaluating costs O(responses * poles) and involves no network solve.
+class RationalModel {
+public:
+  /// @brief Constructs a model from its poles, residues and constants.
+  /// Throws std::runtime_error if the dimensions do not fit together.
+  /// @param poles Poles in radians per second.
+  /// @param residues Residues, one row per response and one column per pole.
+  /// @param constants Constant terms, one per response.
+  RationalModel(arma::cx_vec poles, arma::cx_mat residues, arma::cx_vec constants);
+
+  /// @brief Default destructor.
+  ~RationalModel() = default;
+
+  /// @brief Evaluates all responses at one frequency.
+  /// @param frequency Frequency in hertz.
+  /// @return Responses, one per row of the residues.
+  arma::cx_vec evaluate(float frequency) const;
+
+  /// @brief Evaluates all responses at several frequencies.
+  /// @param frequencies Frequencies in hertz.
+  /// @return Responses, one row per response and one column per frequency.
+  arma::cx_mat evaluate(const std::vector<float> &frequencies) const;
+
+  /// @brief Returns the poles.
+  /// @return Const reference to the poles in radians per second.
+  const arma::cx_vec &getPoles() const noexcept;
+
+  /// @brief Returns the residues.
+  /// @return Const reference to the residues, one row per response.
+  const arma::cx_mat &getResidues() const noexcept;
+
+  /// @brief Returns the constant terms.
+  /// @return Const reference to the constants, one per response.
+  const arma::cx_vec &getConstants() const noexcept;
+
+  /// @brief Returns the number of poles, counting both poles of a conjugate pair.
+  /// @return Pole count.
+  arma::uword getNumberOfPoles() const noexcept;
+
+  /// @brief Returns the number of responses.
+  /// @return Response count.
+  arma::uword getNumberOfResponses() const noexcept;
+
+private:
+  arma::cx_vec m_poles;
+  arma::cx_mat m_residues;
+  arma::cx_vec m_constants;
+};
+
+/// @brief Settings of a vector fit.
+/// With numberOfPoles set to zero the order is chosen automatically: it starts at two poles and
+/// grows by two until the relative RMS error is within tolerance or maxPoles is reached.
+struct VectorFittingOptions {
+  uint32_t numberOfPoles = 0;
+  uint32_t maxPoles = 30;
+  double tolerance = 1e-3;
+  uint32_t iterations = 10;
+};
+
+/// @brief Fitted model and its quality on the fitted samples.
+/// relativeRmsError is the RMS error divided by the RMS value of the fitted responses.
+struct VectorFittingResult {
+  std::shared_ptr<const RationalModel> model;
+  arma::uword numberOfPoles;
+  double rmsError;
+  double relativeRmsError;
+  double maxError;
+};
+
+/// @brief Provides static methods for fitting rational models to frequency sweeps.
+/// Uses vector fitting (B. Gustavsen and A. Semlyen, 1999): the poles are relocated iteratively
+/// by solving a linearized least squares problem shared by all responses, and the residues are
+/// then found by linear least squares. Unstable poles are reflected into the left half plane.
+/// This class cannot be instantiated.
+class VectorFitting {
+public:
+  /// @brief Make the class non-instantiable.
+  VectorFitting() = delete;
+
+  /// @brief Fits a model to selected rows of a sweep.
+  /// Throws std::runtime_error if no rows are selected, a row is out of range or there are too
+  /// few samples for the number of poles.
+  /// @param sweep Sweep to fit. Frequencies must be distinct.
+  /// @param rows Indices of the fitted unknowns in the solution vectors.
+  /// @param options Settings of the fit.
+  /// @return Model, with one response per selected row, and its quality.
+  static VectorFittingResult fit(const FrequencySweepResult &sweep,
+                                 const std::vector<arma::uword> &rows,
+                                 const VectorFittingOptions &options = VectorFittingOptions());
+
+  /// @brief Fits a model to the voltages of selected buses of a circuit.
+  /// Throws std::runtime_error as fit does, or if a bus is unknown or grounded.
+  /// @param circuit Circuit the sweep was computed for.
+  /// @param sweep Sweep to fit.
+  /// @param buses IDs of the fitted buses.
+  /// @param options Settings of the fit.
+  /// @return Model, with one response per bus, and its quality.
+  static VectorFittingResult fitBuses(const std::shared_ptr<const Circuit> &circuit,
+                                      const FrequencySweepResult &sweep,
+                                      const std::vector<components::BusId> &buses,
+                                      const VectorFittingOptions &options = VectorFittingOptions());
+
+private:
+  /// @brief Fits a model with a fixed number of poles.
+  /// @param points Sample points s = j * 2 * pi * f.
+  /// @param responses Sampled responses, one row per point and one column per response.
+  /// @param numberOfPoles Number of poles.
+  /// @param iterations Number of pole relocations.
+  /// @return Model and its quality.
+  static VectorFittingResult _fitOrder(const std::vector<std::complex<double>> &points,
+                                       const arma::cx_mat &responses, uint32_t numberOfPoles,
+                                       uint32_t iterations);
+};
+
+} // namespace ocira::core
+
+#endif // OCIRA_CORE_VECTOR_FITTING_HPP
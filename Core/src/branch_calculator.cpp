@@ -0,0 +1,188 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        branch_calculator.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Branch currents, voltage drops and power of every component.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Read voltage source rows from CircuitTransformer.
+// - 2026-10-19 Martin Vidjeskog: Reject circuits with subcircuit instances.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "branch_calculator.hpp"
+#include "ac_current_source.hpp"
+#include "ac_voltage_source.hpp"
+#include "capacitor.hpp"
+#include "circuit.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_transformer.hpp"
+#include "dc_current_source.hpp"
+#include "dc_voltage_source.hpp"
+#include "inductor.hpp"
+#include "resistor.hpp"
+#include <stdexcept>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+BranchCalculator::BranchCalculator(const CircuitTransformer &transformer) {
+  const CircuitSnapshot &snapshot = transformer.getSnapshot();
+  const Circuit &circuit = *snapshot.getCircuit();
+  if (!circuit.getSubcircuitInstances().empty()) {
+    throw std::runtime_error("Branch calculation does not support subcircuit instances!");
+  }
+  const auto &busIdMap = transformer.getBusIdMap();
+  const float frequency = snapshot.getFrequency();
+
+  this->m_size = transformer.getAdmittanceMatrix()->n_rows;
+  this->m_powerFactor = snapshot.getSimulationMode() == SimulationMode::AC ? 0.5 : 1.0;
+
+  // Index of the extra zero entry that stands for ground and for unused auxiliary currents.
+  const arma::uword zero = this->m_size;
+
+  for (const auto &component : circuit.getComponents()) {
+    const ComponentType type = component->getComponentType();
+    if (type == ComponentType::GROUND || type == ComponentType::WIRE) {
+      continue;
+    }
+
+    const auto &connections = component->getConnections();
+    auto b1 = connections[0].bus.lock();
+    auto b2 = connections[1].bus.lock();
+    if (!b1 || !b2) {
+      throw std::runtime_error("Unexpected error! Pointer not existing!");
+    }
+    const BusNumber first = busIdMap.at(b1->getId());
+    const BusNumber second = busIdMap.at(b2->getId());
+
+    // Sources point from their negative to their positive terminal. Seen from the first
+    // connection, that is forwards if the second connection is the positive one.
+    const double direction = connections[1].role == TerminalRole::POSITIVE ? 1.0 : -1.0;
+    const ComponentOverride *override = snapshot.findOverride(component->getId());
+    std::complex<double> admittance = 0.0;
+    std::complex<double> current = 0.0;
+    arma::uword auxiliary = zero;
+    double auxiliarySign = 0.0;
+
+    switch (type) {
+    case ComponentType::RESISTOR:
+      admittance = Resistor::computeConductance(
+          override ? override->value : static_cast<const Resistor &>(*component).getResistance());
+      break;
+    case ComponentType::CAPACITOR:
+      admittance = std::complex<double>(Capacitor::computeAdmittance(
+          override ? override->value
+                   : static_cast<const Capacitor &>(*component).getCapacitance(),
+          frequency));
+      break;
+    case ComponentType::INDUCTOR:
+      admittance = std::complex<double>(Inductor::computeAdmittance(
+          override ? override->value
+                   : static_cast<const Inductor &>(*component).getInductance(),
+          frequency));
+      break;
+    case ComponentType::DC_CURRENT_SOURCE:
+      current = direction * (override ? override->value
+                                      : static_cast<const DCCurrentSource &>(*component).getAmps());
+      break;
+    case ComponentType::AC_CURRENT_SOURCE: {
+      const auto &source = static_cast<const ACCurrentSource &>(*component);
+      current = direction * std::complex<double>(
+                                override ? ACCurrentSource::computePhasor(override->value,
+                                                                          override->phase)
+                                         : source.getPhasor());
+      break;
+    }
+    case ComponentType::DC_VOLTAGE_SOURCE:
+    case ComponentType::AC_VOLTAGE_SOURCE:
+      // The auxiliary current flows into the positive terminal, through the source.
+      auxiliary = transformer.getVoltageSourceRow(component->getId());
+      auxiliarySign = -direction;
+      break;
+    default:
+      throw std::runtime_error("Unsupported component type!");
+    }
+
+    this->m_componentIds.push_back(component->getId());
+    this->m_first.push_back(first != 0 ? first - 1 : zero);
+    this->m_second.push_back(second != 0 ? second - 1 : zero);
+    this->m_auxiliary.push_back(auxiliary);
+    this->m_admittances.push_back(admittance);
+    this->m_currents.push_back(current);
+    this->m_auxiliarySigns.push_back(auxiliarySign);
+    this->m_isSource.push_back(type != ComponentType::RESISTOR &&
+                               type != ComponentType::CAPACITOR &&
+                               type != ComponentType::INDUCTOR);
+  }
+}
+
+BranchQuantities BranchCalculator::compute(const arma::cx_vec &solution) const {
+  if (solution.n_elem != this->m_size) {
+    throw std::runtime_error("Solution does not match the circuit!");
+  }
+
+  // The solution with a zero appended for ground.
+  std::vector<std::complex<double>> x(solution.memptr(), solution.memptr() + solution.n_elem);
+  x.push_back(0.0);
+
+  const size_t size = this->m_componentIds.size();
+  BranchQuantities result;
+  result.componentIds = this->m_componentIds;
+  result.voltages.set_size(size);
+  result.currents.set_size(size);
+  result.powers.set_size(size);
+  std::complex<double> *voltages = result.voltages.memptr();
+  std::complex<double> *currents = result.currents.memptr();
+  std::complex<double> *powers = result.powers.memptr();
+
+  for (size_t k = 0; k < size; k++) {
+    const std::complex<double> voltage = x[this->m_first[k]] - x[this->m_second[k]];
+    const std::complex<double> current = this->m_admittances[k] * voltage + this->m_currents[k] +
+                                         this->m_auxiliarySigns[k] * x[this->m_auxiliary[k]];
+    voltages[k] = voltage;
+    currents[k] = current;
+    powers[k] = this->m_powerFactor * voltage * std::conj(current);
+  }
+
+  result.sourcePower = 0.0;
+  result.loadPower = 0.0;
+  for (size_t k = 0; k < size; k++) {
+    if (this->m_isSource[k]) {
+      result.sourcePower -= powers[k];
+    } else {
+      result.loadPower += powers[k];
+    }
+  }
+  return result;
+}
+
+const std::vector<ComponentId> &BranchCalculator::getComponentIds() const noexcept {
+  return this->m_componentIds;
+}
+
+} // namespace ocira::core
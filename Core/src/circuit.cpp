@@ -25,6 +25,10 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Move buses and components into the circuit.
+// - 2026-10-19 Martin Vidjeskog: Keep track of the arena holding the circuit elements.
+// - 2026-10-19 Martin Vidjeskog: Store subcircuit instances.
+// - 2026-10-19 Martin Vidjeskog: Store ports.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -33,8 +37,11 @@
 
 #include "circuit.hpp"
 #include "bus.hpp"
+#include "circuit_arena.hpp"
 #include "component.hpp"
+#include "subcircuit.hpp"
 #include <cmath>
+#include <utility>
 
 using namespace ocira::core::components;
 
@@ -52,12 +59,28 @@ const std::vector<std::shared_ptr<Component>> &Circuit::getComponents() const {
 
 const std::vector<std::shared_ptr<Bus>> &Circuit::getBuses() const { return this->m_buses; }
 
-void Circuit::setBuses(std::vector<std::shared_ptr<Bus>> buses) { this->m_buses = buses; }
+void Circuit::setBuses(std::vector<std::shared_ptr<Bus>> buses) {
+  this->m_buses = std::move(buses);
+}
 
 void Circuit::setComponents(std::vector<std::shared_ptr<Component>> components) {
-  this->m_components = components;
+  this->m_components = std::move(components);
+}
+
+const std::vector<std::shared_ptr<const SubcircuitInstance>> &
+Circuit::getSubcircuitInstances() const {
+  return this->m_subcircuitInstances;
+}
+
+void Circuit::setSubcircuitInstances(
+    std::vector<std::shared_ptr<const SubcircuitInstance>> instances) {
+  this->m_subcircuitInstances = std::move(instances);
 }
 
+const std::vector<Port> &Circuit::getPorts() const { return this->m_ports; }
+
+void Circuit::setPorts(std::vector<Port> ports) { this->m_ports = std::move(ports); }
+
 void Circuit::setSimulationMode(SimulationMode mode) {
   if (this->m_simulationMode != mode) {
     this->m_frequency = mode == SimulationMode::DC ? 0.0f : 50.0f;
@@ -74,4 +97,8 @@ void Circuit::setFrequency(float frequency) noexcept {
 
 float Circuit::getFrequency() const noexcept { return this->m_frequency; }
 
+void Circuit::setArena(std::shared_ptr<CircuitArena> arena) { this->m_arena = std::move(arena); }
+
+std::shared_ptr<CircuitArena> Circuit::getArena() const { return this->m_arena; }
+
 } // namespace ocira::core
\ No newline at end of file
@@ -0,0 +1,67 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_arena.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Slab arena for allocating circuit elements.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "circuit_arena.hpp"
+#include <algorithm>
+
+namespace ocira::core {
+
+CircuitArena::CircuitArena(size_t slabSize)
+    : m_slabSize(std::max<size_t>(slabSize, 1)), m_cursor(nullptr), m_remaining(0),
+      m_bytesAllocated(0) {}
+
+void *CircuitArena::allocate(size_t bytes, size_t alignment) {
+  void *cursor = this->m_cursor;
+
+  // Start a new slab if the block does not fit in the current one.
+  if (cursor == nullptr || std::align(alignment, bytes, cursor, this->m_remaining) == nullptr) {
+    size_t slabSize = std::max(this->m_slabSize, bytes + alignment);
+    // Slabs are left uninitialized, the elements placed in them are constructed in place.
+    this->m_slabs.push_back(std::unique_ptr<std::byte[]>(new std::byte[slabSize]));
+    cursor = this->m_slabs.back().get();
+    this->m_remaining = slabSize;
+    std::align(alignment, bytes, cursor, this->m_remaining);
+  }
+
+  this->m_cursor = static_cast<std::byte *>(cursor) + bytes;
+  this->m_remaining -= bytes;
+  this->m_bytesAllocated += bytes;
+
+  return cursor;
+}
+
+size_t CircuitArena::getBytesAllocated() const noexcept { return this->m_bytesAllocated; }
+
+size_t CircuitArena::getNumberOfSlabs() const noexcept { return this->m_slabs.size(); }
+
+} // namespace ocira::core
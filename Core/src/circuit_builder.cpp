@@ -0,0 +1,217 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_builder.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Bulk construction of circuits from typed edge lists.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add arena allocation mode.
+// - 2026-10-19 Martin Vidjeskog: Create diodes.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "circuit_builder.hpp"
+#include "ac_current_source.hpp"
+#include "ac_voltage_source.hpp"
+#include "capacitor.hpp"
+#include "circuit.hpp"
+#include "circuit_arena.hpp"
+#include "dc_current_source.hpp"
+#include "dc_voltage_source.hpp"
+#include "diode.hpp"
+#include "ground.hpp"
+#include "inductor.hpp"
+#include "resistor.hpp"
+#include "wire.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+/// @brief Estimated arena footprint of a bus, including its control block.
+static constexpr size_t ARENA_BYTES_PER_BUS = 80;
+
+/// @brief Estimated arena footprint of a component, including its control block.
+static constexpr size_t ARENA_BYTES_PER_COMPONENT = 96;
+
+/// @brief Creates a circuit element either in the arena or on the heap.
+template <typename T, typename... Args>
+static std::shared_ptr<T> makeElement(const std::shared_ptr<CircuitArena> &arena, Args &&...args) {
+  if (arena) {
+    return std::allocate_shared<T>(ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+  }
+
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+CircuitBuilder::CircuitBuilder(SimulationMode mode, AllocationMode allocationMode)
+    : m_simulationMode(mode), m_allocationMode(allocationMode) {}
+
+void CircuitBuilder::reserve(size_t numberOfBuses, size_t numberOfComponents) {
+  this->m_busIds.reserve(numberOfBuses);
+  this->m_descriptors.reserve(numberOfComponents);
+}
+
+void CircuitBuilder::addBus(BusId id) { this->m_busIds.push_back(id); }
+
+void CircuitBuilder::addComponent(const ComponentDescriptor &descriptor) {
+  this->m_descriptors.push_back(descriptor);
+}
+
+void CircuitBuilder::addComponents(const std::vector<ComponentDescriptor> &descriptors) {
+  this->m_descriptors.insert(this->m_descriptors.end(), descriptors.begin(), descriptors.end());
+}
+
+std::shared_ptr<Circuit> CircuitBuilder::build() {
+  std::vector<BusId> busIds = std::move(this->m_busIds);
+  std::vector<ComponentDescriptor> descriptors = std::move(this->m_descriptors);
+  this->m_busIds.clear();
+  this->m_descriptors.clear();
+
+  // 1. Assign each bus a dense index. Explicitly added buses keep their order, buses that are only
+  // referenced by components follow in order of first appearance.
+  std::unordered_map<BusId, uint32_t> busIndices;
+  busIndices.reserve(busIds.size() + descriptors.size());
+  std::vector<BusId> orderedBusIds;
+  orderedBusIds.reserve(busIds.size() + descriptors.size());
+
+  auto indexOf = [&](BusId id) {
+    auto inserted = busIndices.emplace(id, static_cast<uint32_t>(orderedBusIds.size()));
+    if (inserted.second) {
+      orderedBusIds.push_back(id);
+    }
+    return inserted.first->second;
+  };
+
+  for (BusId id : busIds) {
+    indexOf(id);
+  }
+
+  // 2. Resolve the terminals of each component and count the connections per bus.
+  std::vector<uint32_t> terminalA(descriptors.size());
+  std::vector<uint32_t> terminalB(descriptors.size());
+
+  for (size_t k = 0; k < descriptors.size(); k++) {
+    const ComponentDescriptor &descriptor = descriptors[k];
+    terminalA[k] = indexOf(descriptor.busA);
+
+    // Ground has a single terminal. A component connected twice to the same bus keeps only the
+    // first connection, the same way Bus::addConnection and Component::addConnection behave.
+    bool singleTerminal =
+        descriptor.type == ComponentType::GROUND || descriptor.busA == descriptor.busB;
+    terminalB[k] = singleTerminal ? terminalA[k] : indexOf(descriptor.busB);
+  }
+
+  std::vector<uint32_t> degrees(orderedBusIds.size(), 0);
+  for (size_t k = 0; k < descriptors.size(); k++) {
+    degrees[terminalA[k]]++;
+    if (terminalB[k] != terminalA[k]) {
+      degrees[terminalB[k]]++;
+    }
+  }
+
+  // 3. Size the arena so that the whole circuit normally fits in a single slab.
+  std::shared_ptr<CircuitArena> arena;
+  if (this->m_allocationMode == AllocationMode::ARENA) {
+    size_t arenaSize = orderedBusIds.size() * ARENA_BYTES_PER_BUS +
+                       descriptors.size() * ARENA_BYTES_PER_COMPONENT;
+    arena = std::make_shared<CircuitArena>(std::max(arenaSize, CircuitArena::DEFAULT_SLAB_SIZE));
+  }
+
+  // 4. Create the buses with exactly the capacity they need.
+  std::vector<std::shared_ptr<Bus>> buses;
+  buses.reserve(orderedBusIds.size());
+  for (size_t b = 0; b < orderedBusIds.size(); b++) {
+    std::shared_ptr<Bus> bus = makeElement<Bus>(arena, orderedBusIds[b]);
+    bus->m_components.reserve(degrees[b]);
+    buses.push_back(std::move(bus));
+  }
+
+  // 5. Create the components and write both sides of every connection.
+  std::vector<std::shared_ptr<Component>> components;
+  components.reserve(descriptors.size());
+  for (size_t k = 0; k < descriptors.size(); k++) {
+    const ComponentDescriptor &descriptor = descriptors[k];
+    std::shared_ptr<Component> component = _createComponent(descriptor, arena);
+
+    const std::shared_ptr<Bus> &busA = buses[terminalA[k]];
+    component->m_connections.reserve(terminalA[k] == terminalB[k] ? 1 : 2);
+    component->m_connections.push_back({busA, descriptor.roleA});
+    busA->m_components.push_back(component);
+
+    if (terminalA[k] != terminalB[k]) {
+      const std::shared_ptr<Bus> &busB = buses[terminalB[k]];
+      component->m_connections.push_back({busB, descriptor.roleB});
+      busB->m_components.push_back(component);
+    }
+
+    components.push_back(std::move(component));
+  }
+
+  // 6. Hand the storage over to the circuit.
+  std::shared_ptr<Circuit> circuit = std::make_shared<Circuit>(this->m_simulationMode);
+  circuit->setArena(std::move(arena));
+  circuit->setBuses(std::move(buses));
+  circuit->setComponents(std::move(components));
+
+  return circuit;
+}
+
+// PRIVATE METHODS
+
+std::shared_ptr<Component>
+CircuitBuilder::_createComponent(const ComponentDescriptor &descriptor,
+                                 const std::shared_ptr<CircuitArena> &arena) {
+  switch (descriptor.type) {
+  case ComponentType::AC_CURRENT_SOURCE:
+    return makeElement<ACCurrentSource>(arena, descriptor.id, descriptor.value, descriptor.phase);
+  case ComponentType::AC_VOLTAGE_SOURCE:
+    return makeElement<ACVoltageSource>(arena, descriptor.id, descriptor.value, descriptor.phase);
+  case ComponentType::CAPACITOR:
+    return makeElement<Capacitor>(arena, descriptor.id, descriptor.value);
+  case ComponentType::DC_CURRENT_SOURCE:
+    return makeElement<DCCurrentSource>(arena, descriptor.id, descriptor.value);
+  case ComponentType::DC_VOLTAGE_SOURCE:
+    return makeElement<DCVoltageSource>(arena, descriptor.id, descriptor.value);
+  case ComponentType::DIODE:
+    return makeElement<Diode>(arena, descriptor.id, descriptor.value);
+  case ComponentType::GROUND:
+    return makeElement<Ground>(arena, descriptor.id);
+  case ComponentType::INDUCTOR:
+    return makeElement<Inductor>(arena, descriptor.id, descriptor.value);
+  case ComponentType::RESISTOR:
+    return makeElement<Resistor>(arena, descriptor.id, descriptor.value);
+  case ComponentType::WIRE:
+    return makeElement<Wire>(arena, descriptor.id);
+  default:
+    throw std::runtime_error("Unsupported component type!");
+  }
+}
+
+} // namespace ocira::core
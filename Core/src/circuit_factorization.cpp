@@ -0,0 +1,175 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_factorization.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Reusable LU factorization of an admittance matrix.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Solve with the transposed factors in place.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "circuit_factorization.hpp"
+#include <complex>
+#include <stdexcept>
+#include <utility>
+
+namespace ocira::core {
+
+CircuitFactorization::CircuitFactorization(const arma::cx_mat &Y) {
+  if (Y.n_rows != Y.n_cols) {
+    throw std::runtime_error("Admittance matrix is not square!");
+  }
+
+  arma::cx_mat P;
+  if (!arma::lu(this->m_L, this->m_U, P, Y)) {
+    throw std::runtime_error("Admittance matrix is singular!");
+  }
+
+  // Store the permutation matrix as an index vector, so that applying it costs O(n).
+  this->m_permutation.resize(Y.n_rows);
+  for (arma::uword row = 0; row < P.n_rows; row++) {
+    for (arma::uword column = 0; column < P.n_cols; column++) {
+      if (P(row, column) != 0.0) {
+        this->m_permutation[row] = column;
+        break;
+      }
+    }
+  }
+
+  this->_checkFactors();
+}
+
+CircuitFactorization::CircuitFactorization(arma::cx_mat L, arma::cx_mat U,
+                                           std::vector<arma::uword> permutation)
+    : m_L(std::move(L)), m_U(std::move(U)), m_permutation(std::move(permutation)) {
+  // The permutation must map every row exactly once.
+  std::vector<bool> seen(this->m_permutation.size(), false);
+  for (arma::uword row : this->m_permutation) {
+    if (row >= seen.size() || seen[row]) {
+      throw std::runtime_error("Permutation is not valid!");
+    }
+    seen[row] = true;
+  }
+
+  this->_checkFactors();
+}
+
+arma::cx_vec CircuitFactorization::solve(const arma::cx_vec &b) const {
+  const arma::uword n = this->getSize();
+  if (b.n_elem != n) {
+    throw std::runtime_error("Right-hand side does not match the factorization!");
+  }
+
+  arma::cx_vec permuted(n);
+  for (arma::uword k = 0; k < n; k++) {
+    permuted(k) = b(this->m_permutation[k]);
+  }
+
+  arma::cx_vec y = arma::solve(arma::trimatl(this->m_L), permuted);
+  arma::cx_vec x = arma::solve(arma::trimatu(this->m_U), y);
+  return x;
+}
+
+arma::cx_mat CircuitFactorization::solve(const arma::cx_mat &B) const {
+  const arma::uword n = this->getSize();
+  if (B.n_rows != n) {
+    throw std::runtime_error("Right-hand side does not match the factorization!");
+  }
+
+  arma::cx_mat permuted(n, B.n_cols);
+  for (arma::uword column = 0; column < B.n_cols; column++) {
+    for (arma::uword k = 0; k < n; k++) {
+      permuted(k, column) = B(this->m_permutation[k], column);
+    }
+  }
+
+  arma::cx_mat Y = arma::solve(arma::trimatl(this->m_L), permuted);
+  arma::cx_mat X = arma::solve(arma::trimatu(this->m_U), Y);
+  return X;
+}
+
+arma::cx_vec CircuitFactorization::solveTransposed(const arma::cx_vec &b) const {
+  const arma::uword n = this->getSize();
+  if (b.n_elem != n) {
+    throw std::runtime_error("Right-hand side does not match the factorization!");
+  }
+
+  // Y^T = U^T * L^T * P, so solve U^T * z = b, then L^T * w = z and finally x = P^T * w.
+  // Row k of a transposed factor is column k of the factor, so both substitutions read the
+  // factors in place instead of transposing them.
+  arma::cx_vec z(n);
+  for (arma::uword k = 0; k < n; k++) {
+    std::complex<double> sum = b(k);
+    for (arma::uword j = 0; j < k; j++) {
+      sum -= this->m_U(j, k) * z(j);
+    }
+    z(k) = sum / this->m_U(k, k);
+  }
+
+  arma::cx_vec w(n);
+  for (arma::uword k = n; k-- > 0;) {
+    std::complex<double> sum = z(k);
+    for (arma::uword j = k + 1; j < n; j++) {
+      sum -= this->m_L(j, k) * w(j);
+    }
+    w(k) = sum / this->m_L(k, k);
+  }
+
+  arma::cx_vec x(n);
+  for (arma::uword k = 0; k < n; k++) {
+    x(this->m_permutation[k]) = w(k);
+  }
+  return x;
+}
+
+arma::uword CircuitFactorization::getSize() const noexcept { return this->m_U.n_rows; }
+
+const arma::cx_mat &CircuitFactorization::getLower() const noexcept { return this->m_L; }
+
+const arma::cx_mat &CircuitFactorization::getUpper() const noexcept { return this->m_U; }
+
+const std::vector<arma::uword> &CircuitFactorization::getPermutation() const noexcept {
+  return this->m_permutation;
+}
+
+// PRIVATE METHODS
+
+void CircuitFactorization::_checkFactors() const {
+  const arma::uword n = this->m_U.n_rows;
+  if (this->m_U.n_cols != n || this->m_L.n_rows != n || this->m_L.n_cols != n ||
+      this->m_permutation.size() != n) {
+    throw std::runtime_error("Factors do not fit together!");
+  }
+
+  for (arma::uword k = 0; k < n; k++) {
+    if (this->m_U(k, k) == 0.0) {
+      throw std::runtime_error("Admittance matrix is singular!");
+    }
+  }
+}
+
+} // namespace ocira::core
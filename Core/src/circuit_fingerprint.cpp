@@ -0,0 +1,188 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_fingerprint.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Structural hashes of circuits.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Hash diode parameters.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "circuit_fingerprint.hpp"
+#include "ac_current_source.hpp"
+#include "ac_voltage_source.hpp"
+#include "bus.hpp"
+#include "capacitor.hpp"
+#include "circuit.hpp"
+#include "dc_current_source.hpp"
+#include "dc_voltage_source.hpp"
+#include "diode.hpp"
+#include "inductor.hpp"
+#include "resistor.hpp"
+#include "subcircuit.hpp"
+#include <cstring>
+#include <unordered_map>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+namespace {
+
+/// Streaming 64-bit hash. Each word is mixed with the splitmix64 finalizer.
+class Hasher {
+public:
+  void add(uint64_t value) noexcept {
+    uint64_t x = this->m_state ^ (value + 0x9e3779b97f4a7c15ull);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    this->m_state = x ^ (x >> 31);
+  }
+
+  void add(float value) noexcept {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    this->add(static_cast<uint64_t>(bits));
+  }
+
+  uint64_t get() const noexcept { return this->m_state; }
+
+private:
+  uint64_t m_state = 0;
+};
+
+/// Hashers for the three levels of a fingerprint.
+struct FingerprintHashers {
+  Hasher topology;
+  Hasher admittance;
+  Hasher full;
+};
+
+} // namespace
+
+static void hashComponent(const Component &component, FingerprintHashers &hashers) {
+  const ComponentType type = component.getComponentType();
+  hashers.topology.add(static_cast<uint64_t>(type));
+  hashers.topology.add(static_cast<uint64_t>(component.getId()));
+
+  for (const Connection &connection : component.getConnections()) {
+    std::shared_ptr<Bus> bus = connection.bus.lock();
+    hashers.topology.add(bus ? static_cast<uint64_t>(bus->getId()) : UINT64_MAX);
+    hashers.topology.add(static_cast<uint64_t>(connection.role));
+  }
+
+  switch (type) {
+  case ComponentType::RESISTOR:
+    hashers.admittance.add(static_cast<const Resistor &>(component).getResistance());
+    break;
+  case ComponentType::CAPACITOR:
+    hashers.admittance.add(static_cast<const Capacitor &>(component).getCapacitance());
+    break;
+  case ComponentType::INDUCTOR:
+    hashers.admittance.add(static_cast<const Inductor &>(component).getInductance());
+    break;
+  case ComponentType::DIODE: {
+    const auto &diode = static_cast<const Diode &>(component);
+    hashers.admittance.add(diode.getSaturationCurrent());
+    hashers.admittance.add(diode.getEmissionCoefficient());
+    break;
+  }
+  case ComponentType::DC_CURRENT_SOURCE:
+    hashers.full.add(static_cast<const DCCurrentSource &>(component).getAmps());
+    break;
+  case ComponentType::DC_VOLTAGE_SOURCE:
+    hashers.full.add(static_cast<const DCVoltageSource &>(component).getVolts());
+    break;
+  case ComponentType::AC_CURRENT_SOURCE: {
+    const auto &source = static_cast<const ACCurrentSource &>(component);
+    hashers.full.add(source.getAmplitude());
+    hashers.full.add(source.getPhase());
+    break;
+  }
+  case ComponentType::AC_VOLTAGE_SOURCE: {
+    const auto &source = static_cast<const ACVoltageSource &>(component);
+    hashers.full.add(source.getAmplitude());
+    hashers.full.add(source.getPhase());
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+CircuitFingerprint CircuitFingerprinter::compute(const Circuit &circuit) {
+  FingerprintHashers hashers;
+  hashers.topology.add(static_cast<uint64_t>(circuit.getSimulationMode()));
+  hashers.admittance.add(circuit.getFrequency());
+
+  hashers.topology.add(static_cast<uint64_t>(circuit.getBuses().size()));
+  for (const std::shared_ptr<Bus> &bus : circuit.getBuses()) {
+    hashers.topology.add(static_cast<uint64_t>(bus->getId()));
+  }
+
+  hashers.topology.add(static_cast<uint64_t>(circuit.getComponents().size()));
+  for (const std::shared_ptr<Component> &component : circuit.getComponents()) {
+    hashComponent(*component, hashers);
+  }
+
+  // Each subcircuit definition is hashed once. Instances refer to it by its position among the
+  // definitions, so that the hash does not depend on where the definitions are in memory.
+  std::unordered_map<const SubcircuitDefinition *, uint64_t> definitions;
+  for (const auto &instance : circuit.getSubcircuitInstances()) {
+    const SubcircuitDefinition &definition = *instance->getDefinition();
+    auto it = definitions.find(&definition);
+    if (it == definitions.end()) {
+      it = definitions.emplace(&definition, definitions.size()).first;
+      for (BusId port : definition.getPorts()) {
+        hashers.topology.add(static_cast<uint64_t>(port));
+      }
+      for (const std::shared_ptr<Component> &component : definition.getComponents()) {
+        hashComponent(*component, hashers);
+      }
+    }
+
+    hashers.topology.add(it->second);
+    hashers.topology.add(static_cast<uint64_t>(instance->getId()));
+    for (BusId bus : instance->getPortBuses()) {
+      hashers.topology.add(static_cast<uint64_t>(bus));
+    }
+  }
+
+  CircuitFingerprint fingerprint;
+  fingerprint.topology = hashers.topology.get();
+
+  Hasher admittance = hashers.admittance;
+  admittance.add(fingerprint.topology);
+  fingerprint.admittance = admittance.get();
+
+  Hasher full = hashers.full;
+  full.add(fingerprint.admittance);
+  fingerprint.full = full.get();
+  return fingerprint;
+}
+
+} // namespace ocira::core
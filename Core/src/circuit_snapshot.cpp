@@ -0,0 +1,144 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_snapshot.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Immutable circuit snapshots with copy-on-write component overrides.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Keep the phase of amplitude-only overrides.
+// - 2026-10-19 Martin Vidjeskog: Share overrides with the parent variant through a chain.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "circuit_snapshot.hpp"
+#include "ac_current_source.hpp"
+#include "ac_voltage_source.hpp"
+#include "circuit.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+CircuitSnapshot::CircuitSnapshot(std::shared_ptr<const Circuit> circuit)
+    : m_circuit(std::move(circuit)), m_overrides(std::make_shared<const OverrideMap>()),
+      m_chain(nullptr), m_numberOfOverrides(0) {
+  this->m_simulationMode = this->m_circuit->getSimulationMode();
+  this->m_frequency = this->m_circuit->getFrequency();
+}
+
+const std::shared_ptr<const Circuit> &CircuitSnapshot::getCircuit() const noexcept {
+  return this->m_circuit;
+}
+
+SimulationMode CircuitSnapshot::getSimulationMode() const noexcept {
+  return this->m_simulationMode;
+}
+
+float CircuitSnapshot::getFrequency() const noexcept { return this->m_frequency; }
+
+CircuitSnapshot CircuitSnapshot::withComponentValue(ComponentId id, float value,
+                                                    std::optional<float> phase) const {
+  // Keep the current phase if none is given: that of an earlier override, or else the phase of
+  // the AC source in the base circuit.
+  const ComponentOverride *previous = this->findOverride(id);
+  if (!phase) {
+    if (previous) {
+      phase = previous->phase;
+    } else {
+      phase = 0.0f;
+      for (const auto &component : this->m_circuit->getComponents()) {
+        if (component->getId() != id) {
+          continue;
+        }
+        if (component->getComponentType() == ComponentType::AC_CURRENT_SOURCE) {
+          phase = std::static_pointer_cast<ACCurrentSource>(component)->getPhase();
+        } else if (component->getComponentType() == ComponentType::AC_VOLTAGE_SOURCE) {
+          phase = std::static_pointer_cast<ACVoltageSource>(component)->getPhase();
+        }
+        break;
+      }
+    }
+  }
+
+  CircuitSnapshot variant = *this;
+  if (!previous) {
+    variant.m_numberOfOverrides++;
+  }
+
+  const size_t chainLength = this->m_chain ? this->m_chain->chainLength : 0;
+  const double mapSize = static_cast<double>(this->m_overrides->size());
+  const size_t maxChainLength =
+      std::max(MIN_CHAIN_LENGTH, static_cast<size_t>(std::sqrt(mapSize)));
+  if (chainLength < maxChainLength) {
+    // Share everything with this snapshot and add the new entry in front of its chain.
+    variant.m_chain = std::make_shared<const OverrideEntry>(
+        OverrideEntry{id, {value, *phase}, this->m_chain, chainLength + 1});
+    return variant;
+  }
+
+  // Copy on write: merge the chain into a new map, the base and this snapshot keep theirs.
+  auto overrides = std::make_shared<OverrideMap>(*this->m_overrides);
+  std::vector<const OverrideEntry *> entries;
+  for (const OverrideEntry *entry = this->m_chain.get(); entry; entry = entry->parent.get()) {
+    entries.push_back(entry);
+  }
+  for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+    (*overrides)[(*it)->id] = (*it)->value;
+  }
+  (*overrides)[id] = {value, *phase};
+
+  variant.m_overrides = std::move(overrides);
+  variant.m_chain = nullptr;
+  return variant;
+}
+
+CircuitSnapshot CircuitSnapshot::withFrequency(float frequency) const {
+  CircuitSnapshot variant = *this;
+  variant.m_frequency =
+      this->m_simulationMode == SimulationMode::DC ? 0.0f : std::abs(frequency);
+  return variant;
+}
+
+const ComponentOverride *CircuitSnapshot::findOverride(ComponentId id) const {
+  // Newer entries come first in the chain.
+  for (const OverrideEntry *entry = this->m_chain.get(); entry; entry = entry->parent.get()) {
+    if (entry->id == id) {
+      return &entry->value;
+    }
+  }
+
+  auto it = this->m_overrides->find(id);
+  return it == this->m_overrides->end() ? nullptr : &it->second;
+}
+
+size_t CircuitSnapshot::getNumberOfOverrides() const noexcept {
+  return this->m_numberOfOverrides;
+}
+
+} // namespace ocira::core
@@ -0,0 +1,73 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        circuit_structs.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: All circuit structs.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "circuit_structs.hpp"
+
+namespace ocira::core {
+
+std::string ValidationError::getMessage() const {
+  switch (this->code) {
+  case ValidationErrorCode::DUPLICATE_IDENTIFIER:
+    return this->elementKind == ElementKind::BUS ? "Duplicate bus ID detected."
+                                                 : "Duplicate component ID detected.";
+  case ValidationErrorCode::UNCONNECTED_BUS:
+    return "Bus without connections.";
+  case ValidationErrorCode::UNCONNECTED_COMPONENT:
+    return "Component without required connections.";
+  case ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED:
+    return "Circuit contains buses that are not reachable from one another.";
+  case ValidationErrorCode::GROUND_COMPONENT_MISSING:
+    return "Ground component is missing.";
+  case ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_DC_SIMULATION:
+    return "Incompatible component for DC simulation mode.";
+  case ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_AC_SIMULATION:
+    return "Incompatible component for AC simulation mode.";
+  case ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_TRANSIENT_SIMULATION:
+    return "Incompatible component for transient simulation mode.";
+  default:
+    return "Unknown validation error.";
+  }
+}
+
+std::string ValidationError::getLocation() const {
+  switch (this->elementKind) {
+  case ElementKind::BUS:
+    return "Bus - " + std::to_string(this->elementId);
+  case ElementKind::COMPONENT:
+    return "Component - " + std::to_string(this->elementId);
+  default:
+    return "";
+  }
+}
+
+} // namespace ocira::core
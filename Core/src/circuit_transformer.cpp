@@ -25,6 +25,13 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Transform circuit snapshots with component overrides.
+// - 2026-10-19 Martin Vidjeskog: Stamp subcircuit definitions once and replay per instance.
+// - 2026-10-19 Martin Vidjeskog: Reject transient circuits.
+// - 2026-10-19 Martin Vidjeskog: Transform the linear part of circuits with diodes.
+// - 2026-10-19 Martin Vidjeskog: Expose the transformed snapshot.
+// - 2026-10-19 Martin Vidjeskog: Expose the rows of voltage source currents.
+// - 2026-10-19 Martin Vidjeskog: Share the bus and voltage source numbering through numberCircuit.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -40,16 +47,52 @@
 #include "dc_voltage_source.hpp"
 #include "inductor.hpp"
 #include "resistor.hpp"
+#include "subcircuit.hpp"
+#include <algorithm>
+#include <utility>
 
 using namespace ocira::core::components;
 
 namespace ocira::core {
 
 CircuitTransformer::CircuitTransformer(const std::shared_ptr<Circuit> &circuit)
-    : m_circuit(circuit) {
+    : CircuitTransformer(CircuitSnapshot(circuit)) {}
+
+CircuitTransformer::CircuitTransformer(const CircuitSnapshot &snapshot)
+    : CircuitTransformer(snapshot, false) {}
+
+CircuitTransformer::CircuitTransformer(const CircuitSnapshot &snapshot, bool skipNonlinear)
+    : m_snapshot(snapshot), m_skipNonlinear(skipNonlinear) {
+  const std::shared_ptr<const Circuit> &circuit = snapshot.getCircuit();
+  if (snapshot.getSimulationMode() == SimulationMode::TRANSIENT) {
+    throw std::runtime_error("Transient circuits are solved with TransientAnalysis!");
+  }
+
+  // 1. Number the buses and voltage sources (ground will be zero).
+  MnaNumbering numbering = numberCircuit(*circuit);
+  this->m_busIdMap = std::move(numbering.busIdMap);
+  this->m_busNumberMap = std::move(numbering.busNumberMap);
+  this->m_instanceNodeOffsets = std::move(numbering.instanceNodeOffsets);
+  this->m_voltageSourceRows = std::move(numbering.voltageSourceRows);
+  this->m_sizeG = numbering.sizeG;
+  this->m_sizeB = numbering.sizeB;
+
+  // 2. Initialize Y matrix and J vector.
+  const uint32_t size = this->m_sizeG + this->m_sizeB;
+  this->m_Y = std::make_shared<arma::cx_mat>(size, size, arma::fill::zeros);
+  this->m_J = std::make_shared<arma::cx_vec>(size, arma::fill::zeros);
+
+  // 3. Loop through the components and update the Y matrix and J vector.
+  this->_transformComponents();
+  this->_transformSubcircuits();
+}
+
+MnaNumbering CircuitTransformer::numberCircuit(const Circuit &circuit) {
+  MnaNumbering numbering;
+
   // 1. Assign each node a indice (ground will be zero).
   uint32_t indice = 1;
-  for (auto bus : circuit->getBuses()) {
+  for (auto bus : circuit.getBuses()) {
     // Check that there is no ground node connected to bus.
     bool isGround = false;
     for (auto component : bus->getComponents()) {
@@ -61,34 +104,35 @@ CircuitTransformer::CircuitTransformer(const std::shared_ptr<Circuit> &circuit)
 
     // Ground connection exists, skip the bus.
     if (isGround) {
-      this->m_busIdMap[bus->getId()] = 0;
-      this->m_busNumberMap[0] = bus->getId();
+      numbering.busIdMap[bus->getId()] = 0;
+      numbering.busNumberMap[0] = bus->getId();
       continue;
     }
 
-    this->m_busIdMap[bus->getId()] = indice;
-    this->m_busNumberMap[indice] = bus->getId();
+    numbering.busIdMap[bus->getId()] = indice;
+    numbering.busNumberMap[indice] = bus->getId();
     indice++;
   }
 
-  // 2. Count the number of voltage sources in circuit.
+  // Internal buses of subcircuit instances are numbered after the buses of the circuit.
+  for (const auto &instance : circuit.getSubcircuitInstances()) {
+    numbering.instanceNodeOffsets.push_back(indice);
+    indice += instance->getDefinition()->getNumberOfInternalBuses();
+  }
+  numbering.sizeG = indice - 1;
+
+  // 2. Give each voltage source a row after the buses.
   uint32_t m = 0;
-  for (auto &component : circuit->getComponents()) {
+  for (auto &component : circuit.getComponents()) {
     auto type = component->getComponentType();
     if (type == ComponentType::DC_VOLTAGE_SOURCE || type == ComponentType::AC_VOLTAGE_SOURCE) {
+      numbering.voltageSourceRows.emplace(component->getId(), numbering.sizeG + m);
       m++;
     }
   }
+  numbering.sizeB = m;
 
-  // 3. Initialize Y matrix and J vector.
-  uint32_t n = indice;
-  this->m_sizeG = n - 1;
-  this->m_sizeB = m;
-  this->m_Y = std::make_shared<arma::cx_mat>(n - 1 + m, n - 1 + m, arma::fill::zeros);
-  this->m_J = std::make_shared<arma::cx_vec>(n - 1 + m, arma::fill::zeros);
-
-  // 4. Loop through the components and update the Y matrix and J vector.
-  this->_transformComponents();
+  return numbering;
 }
 
 std::shared_ptr<arma::cx_mat> CircuitTransformer::getAdmittanceMatrix() const { return this->m_Y; }
@@ -103,17 +147,56 @@ const std::unordered_map<BusId, BusNumber> &CircuitTransformer::getBusIdMap() co
   return this->m_busIdMap;
 }
 
+BusNumber CircuitTransformer::getSubcircuitBusNumber(size_t instanceIndex, BusId busId) const {
+  const auto &instance = this->m_snapshot.getCircuit()->getSubcircuitInstances().at(instanceIndex);
+  const SubcircuitDefinition &definition = *instance->getDefinition();
+  uint32_t local = definition.getLocalIndex(busId);
+
+  if (local < definition.getNumberOfPorts()) {
+    auto it = this->m_busIdMap.find(instance->getPortBuses()[local]);
+    if (it == this->m_busIdMap.end()) {
+      throw std::runtime_error("Subcircuit port bus is not part of the circuit!");
+    }
+    return it->second;
+  }
+
+  return this->m_instanceNodeOffsets[instanceIndex] + local - definition.getNumberOfPorts();
+}
+
+arma::uword CircuitTransformer::getVoltageSourceRow(ComponentId id) const {
+  auto it = this->m_voltageSourceRows.find(id);
+  if (it == this->m_voltageSourceRows.end()) {
+    throw std::runtime_error("Component is not a voltage source of the circuit!");
+  }
+  return it->second;
+}
+
+const CircuitSnapshot &CircuitTransformer::getSnapshot() const noexcept {
+  return this->m_snapshot;
+}
+
+size_t CircuitTransformer::getNumberOfSubcircuitStamps() const noexcept {
+  return this->m_subcircuitStamps.size();
+}
+
 // PRIVATE MEMBER METHODS.
 
-void CircuitTransformer::_transformComponents() {
-  uint32_t voltageSourceCounter = 0;
+uint32_t CircuitTransformer::_getVoltageSourceIndex(const Component &component) const {
+  return static_cast<uint32_t>(this->m_voltageSourceRows.at(component.getId()) - this->m_sizeG);
+}
 
-  for (auto component : m_circuit->getComponents()) {
+void CircuitTransformer::_transformComponents() {
+  for (auto component : m_snapshot.getCircuit()->getComponents()) {
     switch (component->getComponentType()) {
     case ComponentType::GROUND:
       break; // Doesn't affect the matrix directly.
     case ComponentType::WIRE:
       break; // Doesn't affect the matrix directly.
+    case ComponentType::DIODE:
+      if (!this->m_skipNonlinear) {
+        throw std::runtime_error("Circuits with diodes are solved with NonlinearSolver!");
+      }
+      break; // Stamped by NonlinearSolver.
     case ComponentType::RESISTOR: {
       std::shared_ptr<Resistor> resistor = std::dynamic_pointer_cast<Resistor>(component);
       this->_transformResistor(resistor);
@@ -128,18 +211,17 @@ void CircuitTransformer::_transformComponents() {
     case ComponentType::DC_VOLTAGE_SOURCE: {
       std::shared_ptr<DCVoltageSource> dcVoltageSrc =
           std::dynamic_pointer_cast<DCVoltageSource>(component);
-      this->_transformDCVoltageSource(dcVoltageSrc, voltageSourceCounter);
-      voltageSourceCounter++;
+      this->_transformDCVoltageSource(dcVoltageSrc, this->_getVoltageSourceIndex(*component));
       break;
     }
     case ComponentType::CAPACITOR: {
       std::shared_ptr<Capacitor> capacitor = std::dynamic_pointer_cast<Capacitor>(component);
-      this->_transformCapacitor(capacitor, m_circuit->getFrequency());
+      this->_transformCapacitor(capacitor, m_snapshot.getFrequency());
       break;
     }
     case ComponentType::INDUCTOR: {
       std::shared_ptr<Inductor> inductor = std::dynamic_pointer_cast<Inductor>(component);
-      this->_transformInductor(inductor, m_circuit->getFrequency());
+      this->_transformInductor(inductor, m_snapshot.getFrequency());
       break;
     }
     case ComponentType::AC_CURRENT_SOURCE: {
@@ -151,8 +233,7 @@ void CircuitTransformer::_transformComponents() {
     case ComponentType::AC_VOLTAGE_SOURCE: {
       std::shared_ptr<ACVoltageSource> acVoltageSrc =
           std::dynamic_pointer_cast<ACVoltageSource>(component);
-      this->_transformACVoltageSource(acVoltageSrc, voltageSourceCounter);
-      voltageSourceCounter++;
+      this->_transformACVoltageSource(acVoltageSrc, this->_getVoltageSourceIndex(*component));
       break;
     }
     default:
@@ -161,8 +242,132 @@ void CircuitTransformer::_transformComponents() {
   }
 }
 
+void CircuitTransformer::_transformSubcircuits() {
+  const auto &instances = this->m_snapshot.getCircuit()->getSubcircuitInstances();
+  std::vector<BusNumber> nodes;
+
+  for (size_t k = 0; k < instances.size(); k++) {
+    const SubcircuitDefinition &definition = *instances[k]->getDefinition();
+
+    // Stamp the definition the first time it is seen.
+    auto it = this->m_subcircuitStamps.find(&definition);
+    if (it == this->m_subcircuitStamps.end()) {
+      SubcircuitStamp stamp = _stampSubcircuit(definition, this->m_snapshot.getFrequency());
+      it = this->m_subcircuitStamps.emplace(&definition, std::move(stamp)).first;
+    }
+    const SubcircuitStamp &stamp = it->second;
+
+    // Map local nodes to bus numbers: ports to the parent buses, internal buses to the
+    // instance's own range.
+    const uint32_t ports = definition.getNumberOfPorts();
+    nodes.resize(stamp.currents.size());
+    for (uint32_t local = 0; local < ports; local++) {
+      auto bus = this->m_busIdMap.find(instances[k]->getPortBuses()[local]);
+      if (bus == this->m_busIdMap.end()) {
+        throw std::runtime_error("Subcircuit port bus is not part of the circuit!");
+      }
+      nodes[local] = bus->second;
+    }
+    for (uint32_t local = ports; local < nodes.size(); local++) {
+      nodes[local] = this->m_instanceNodeOffsets[k] + local - ports;
+    }
+
+    // Replay the stamp.
+    for (const StampEntry &entry : stamp.admittances) {
+      BusNumber i = nodes[entry.row];
+      BusNumber j = nodes[entry.column];
+      if (i != 0 && j != 0) {
+        (*this->m_Y)(i - 1, j - 1) += entry.value;
+      }
+    }
+
+    for (uint32_t local = 0; local < nodes.size(); local++) {
+      if (nodes[local] != 0) {
+        (*this->m_J)(nodes[local] - 1) += stamp.currents[local];
+      }
+    }
+  }
+}
+
+SubcircuitStamp CircuitTransformer::_stampSubcircuit(const SubcircuitDefinition &definition,
+                                                     float frequency) {
+  SubcircuitStamp stamp;
+  stamp.currents.assign(definition.getPorts().size() + definition.getNumberOfInternalBuses(), 0.0);
+
+  for (const std::shared_ptr<Component> &component : definition.getComponents()) {
+    const auto &connections = component->getConnections();
+    std::complex<double> admittance = 0.0;
+    std::complex<double> current = 0.0;
+
+    switch (component->getComponentType()) {
+    case ComponentType::WIRE:
+      continue; // Doesn't affect the matrix directly.
+    case ComponentType::RESISTOR:
+      admittance = std::dynamic_pointer_cast<Resistor>(component)->getConductance();
+      break;
+    case ComponentType::CAPACITOR:
+      admittance = std::dynamic_pointer_cast<Capacitor>(component)->getAdmittance(frequency);
+      break;
+    case ComponentType::INDUCTOR:
+      admittance = std::dynamic_pointer_cast<Inductor>(component)->getAdmittance(frequency);
+      break;
+    case ComponentType::DC_CURRENT_SOURCE:
+      current = std::dynamic_pointer_cast<DCCurrentSource>(component)->getAmps();
+      break;
+    case ComponentType::AC_CURRENT_SOURCE:
+      current = std::complex<double>(
+          std::dynamic_pointer_cast<ACCurrentSource>(component)->getPhasor());
+      break;
+    default:
+      throw std::runtime_error("Unsupported component type in subcircuit!");
+    }
+
+    auto b1 = connections[0].bus.lock();
+    auto b2 = connections[1].bus.lock();
+    if (!b1 || !b2) {
+      throw std::runtime_error("Unexpected error! Pointer not existing!");
+    }
+
+    uint32_t i = definition.getLocalIndex(b1->getId());
+    uint32_t j = definition.getLocalIndex(b2->getId());
+
+    if (admittance != 0.0) {
+      stamp.admittances.push_back({i, i, admittance});
+      stamp.admittances.push_back({j, j, admittance});
+      stamp.admittances.push_back({i, j, -admittance});
+      stamp.admittances.push_back({j, i, -admittance});
+    }
+
+    if (current != 0.0) {
+      stamp.currents[i] += connections[0].role == TerminalRole::POSITIVE ? current : -current;
+      stamp.currents[j] += connections[1].role == TerminalRole::POSITIVE ? current : -current;
+    }
+  }
+
+  // Merge entries that hit the same position so that replaying touches each one only once.
+  std::sort(stamp.admittances.begin(), stamp.admittances.end(),
+            [](const StampEntry &a, const StampEntry &b) {
+              return a.row != b.row ? a.row < b.row : a.column < b.column;
+            });
+
+  std::vector<StampEntry> merged;
+  for (const StampEntry &entry : stamp.admittances) {
+    if (!merged.empty() && merged.back().row == entry.row &&
+        merged.back().column == entry.column) {
+      merged.back().value += entry.value;
+    } else {
+      merged.push_back(entry);
+    }
+  }
+  stamp.admittances = std::move(merged);
+
+  return stamp;
+}
+
 void CircuitTransformer::_transformResistor(std::shared_ptr<Resistor> resistor) {
-  float conductance = resistor->getConductance();
+  const ComponentOverride *override = this->m_snapshot.findOverride(resistor->getId());
+  float conductance = override ? Resistor::computeConductance(override->value)
+                               : resistor->getConductance();
 
   auto connection1 = resistor->getConnections()[0];
   auto connection2 = resistor->getConnections()[1];
@@ -194,7 +399,8 @@ void CircuitTransformer::_transformResistor(std::shared_ptr<Resistor> resistor)
 }
 
 void CircuitTransformer::_transformDCCurrentSource(std::shared_ptr<DCCurrentSource> dcCurrentSrc) {
-  float amps = dcCurrentSrc->getAmps();
+  const ComponentOverride *override = this->m_snapshot.findOverride(dcCurrentSrc->getId());
+  float amps = override ? override->value : dcCurrentSrc->getAmps();
 
   auto connection1 = dcCurrentSrc->getConnections()[0];
   auto connection2 = dcCurrentSrc->getConnections()[1];
@@ -230,7 +436,8 @@ void CircuitTransformer::_transformDCCurrentSource(std::shared_ptr<DCCurrentSour
 
 void CircuitTransformer::_transformDCVoltageSource(std::shared_ptr<DCVoltageSource> dCVoltageSource,
                                                    uint32_t voltageSourceIndex) {
-  float voltages = dCVoltageSource->getVolts();
+  const ComponentOverride *override = this->m_snapshot.findOverride(dCVoltageSource->getId());
+  float voltages = override ? override->value : dCVoltageSource->getVolts();
 
   auto connection1 = dCVoltageSource->getConnections()[0];
   auto connection2 = dCVoltageSource->getConnections()[1];
@@ -272,7 +479,10 @@ void CircuitTransformer::_transformDCVoltageSource(std::shared_ptr<DCVoltageSour
 
 void CircuitTransformer::_transformCapacitor(std::shared_ptr<components::Capacitor> capacitor,
                                              float frequency) {
-  std::complex<float> admittance = capacitor->getAdmittance(frequency);
+  const ComponentOverride *override = this->m_snapshot.findOverride(capacitor->getId());
+  std::complex<float> admittance = override
+                                       ? Capacitor::computeAdmittance(override->value, frequency)
+                                       : capacitor->getAdmittance(frequency);
 
   auto connection1 = capacitor->getConnections()[0];
   auto connection2 = capacitor->getConnections()[1];
@@ -305,7 +515,10 @@ void CircuitTransformer::_transformCapacitor(std::shared_ptr<components::Capacit
 
 void CircuitTransformer::_transformInductor(std::shared_ptr<components::Inductor> inductor,
                                             float frequency) {
-  std::complex<float> admittance = inductor->getAdmittance(frequency);
+  const ComponentOverride *override = this->m_snapshot.findOverride(inductor->getId());
+  std::complex<float> admittance = override
+                                       ? Inductor::computeAdmittance(override->value, frequency)
+                                       : inductor->getAdmittance(frequency);
 
   auto connection1 = inductor->getConnections()[0];
   auto connection2 = inductor->getConnections()[1];
@@ -338,7 +551,10 @@ void CircuitTransformer::_transformInductor(std::shared_ptr<components::Inductor
 
 void CircuitTransformer::_transformACCurrentSource(
     std::shared_ptr<components::ACCurrentSource> acCurrentSrc) {
-  std::complex<float> amps = acCurrentSrc->getPhasor();
+  const ComponentOverride *override = this->m_snapshot.findOverride(acCurrentSrc->getId());
+  std::complex<float> amps = override
+                                 ? ACCurrentSource::computePhasor(override->value, override->phase)
+                                 : acCurrentSrc->getPhasor();
 
   auto connection1 = acCurrentSrc->getConnections()[0];
   auto connection2 = acCurrentSrc->getConnections()[1];
@@ -374,7 +590,10 @@ void CircuitTransformer::_transformACCurrentSource(
 
 void CircuitTransformer::_transformACVoltageSource(
     std::shared_ptr<components::ACVoltageSource> acVoltageSrc, uint32_t voltageSourceIndex) {
-  std::complex<float> voltages = acVoltageSrc->getPhasor();
+  const ComponentOverride *override = this->m_snapshot.findOverride(acVoltageSrc->getId());
+  std::complex<float> voltages =
+      override ? ACVoltageSource::computePhasor(override->value, override->phase)
+               : acVoltageSrc->getPhasor();
 
   auto connection1 = acVoltageSrc->getConnections()[0];
   auto connection2 = acVoltageSrc->getConnections()[1];
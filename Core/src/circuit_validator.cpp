@@ -25,6 +25,16 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-28 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Traverse buses iteratively with forEachNeighborBus.
+// - 2026-10-19 Martin Vidjeskog: Take subcircuit instances into account.
+// - 2026-10-19 Martin Vidjeskog: Fuse the checks into two sweeps with union-find connectivity.
+// - 2026-10-19 Martin Vidjeskog: Add parallel validation.
+// - 2026-10-19 Martin Vidjeskog: Report compact errors and stop at the error limit.
+// - 2026-10-19 Martin Vidjeskog: Accept all defined component types in transient mode.
+// - 2026-10-19 Martin Vidjeskog: Allow diodes in DC circuits only.
+// - 2026-10-19 Martin Vidjeskog: Partition identifiers into shards once instead of per shard.
+// - 2026-10-19 Martin Vidjeskog: Only mark results as truncated when errors were dropped.
+// - 2026-10-19 Martin Vidjeskog: Join neighbor buses with the allocation-free neighbor walk.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -36,170 +46,453 @@
 #include "circuit.hpp"
 #include "circuit_structs.hpp"
 #include "component.hpp"
+#include "concurrent_disjoint_set.hpp"
+#include "disjoint_set.hpp"
+#include "subcircuit.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
 #include <unordered_set>
 
 using namespace ocira::core::components;
 
 namespace ocira::core {
 
-ValidationResult CircuitValidator::isValidCircuit(const Circuit &circuit) {
-  ValidationResult result = {true};
+namespace {
 
-  // 1. Check that all buses are connected to at least one component.
-  _validateBusConnections(circuit, result);
+/// Errors of each check. They are kept apart during the sweeps so that the result lists them in
+/// the same order as running the checks one after another would.
+struct ValidationFindings {
+  std::vector<ValidationError> busConnections;
+  std::vector<ValidationError> componentConnections;
+  std::vector<ValidationError> simulationMode;
+  std::vector<ValidationError> duplicateBuses;
+  std::vector<ValidationError> duplicateComponents;
+};
 
-  // 2. Check that all components are fully connected.
-  _validateComponentConnections(circuit, result);
+} // namespace
 
-  // 3. Check that ground component exists in circuit.
-  _validateGround(circuit, result);
+static ValidationError unconnectedBusError(const Bus &bus) {
+  return {ValidationErrorCode::UNCONNECTED_BUS, ElementKind::BUS, bus.getId()};
+}
 
-  // 4. Check that all components support the circuit's simulation mode.
-  _validateSimulationModeCompatibility(circuit, result);
+static ValidationError unconnectedComponentError(const Component &component) {
+  return {ValidationErrorCode::UNCONNECTED_COMPONENT, ElementKind::COMPONENT, component.getId()};
+}
 
-  // 5. Check that all buses and components have unique identifiers.
-  _validateUniqueIds(circuit, result);
+static ValidationError duplicateBusError(const Bus &bus) {
+  return {ValidationErrorCode::DUPLICATE_IDENTIFIER, ElementKind::BUS, bus.getId()};
+}
 
-  // 6. Check the full connectivity of the circuit.
-  _validateConnectivity(circuit, result);
+static ValidationError duplicateComponentError(const Component &component) {
+  return {ValidationErrorCode::DUPLICATE_IDENTIFIER, ElementKind::COMPONENT, component.getId()};
+}
 
-  // Additional checks here...
+static void checkModeCompatibility(const Component &component, SimulationMode mode,
+                                   std::vector<ValidationError> &errors) {
+  const ComponentType type = component.getComponentType();
 
-  return result;
+  if (mode == SimulationMode::DC) {
+    switch (type) {
+    case ComponentType::AC_CURRENT_SOURCE:
+    case ComponentType::AC_VOLTAGE_SOURCE:
+    case ComponentType::CAPACITOR:
+    case ComponentType::INDUCTOR:
+    case ComponentType::UNDEFINED:
+      errors.push_back({ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_DC_SIMULATION,
+                        ElementKind::COMPONENT, component.getId()});
+      break;
+    default:
+      break;
+    }
+  } else if (mode == SimulationMode::AC) {
+    switch (type) {
+    case ComponentType::DC_CURRENT_SOURCE:
+    case ComponentType::DC_VOLTAGE_SOURCE:
+    case ComponentType::DIODE:
+    case ComponentType::UNDEFINED:
+      errors.push_back({ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_AC_SIMULATION,
+                        ElementKind::COMPONENT, component.getId()});
+      break;
+    default:
+      break;
+    }
+  } else if (mode == SimulationMode::TRANSIENT) {
+    if (type == ComponentType::UNDEFINED || type == ComponentType::DIODE) {
+      errors.push_back({ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_TRANSIENT_SIMULATION,
+                        ElementKind::COMPONENT, component.getId()});
+    }
+  }
 }
 
-// PRIVATE METHODS
+template <typename Lookup, typename Sets>
+static void uniteConnectedBuses(const Component &component, const Lookup &findBusIndex,
+                                Sets &sets) {
+  uint32_t first = UINT32_MAX;
+
+  for (const Connection &connection : component.getConnections()) {
+    std::shared_ptr<Bus> bus = connection.bus.lock();
+    if (!bus) {
+      continue;
+    }
+
+    const uint32_t index = findBusIndex(bus->getId());
+    if (index == UINT32_MAX) {
+      continue;
+    }
 
-void CircuitValidator::_validateBusConnections(const Circuit &circuit, ValidationResult &result) {
-  for (const std::shared_ptr<Bus> &bus : circuit.getBuses()) {
-    if (!bus->isConnected()) {
-      result.isValid = false;
-      result.errors.push_back({"Bus without connections.", ValidationErrorCode::UNCONNECTED_BUS,
-                               "Bus - " + bus->getId()});
+    if (first == UINT32_MAX) {
+      first = index;
+    } else {
+      sets.unite(first, index);
     }
   }
 }
 
-void CircuitValidator::_validateComponentConnections(const Circuit &circuit,
-                                                     ValidationResult &result) {
-  for (const std::shared_ptr<Component> &component : circuit.getComponents()) {
-    if (!component->isConnected()) {
-      result.isValid = false;
-      result.errors.push_back({"Component without required connections.",
-                               ValidationErrorCode::UNCONNECTED_COMPONENT,
-                               "Component - " + component->getId()});
-    }
+static ValidationResult collectErrors(ValidationFindings &findings, bool hasGround,
+                                      bool isFullyConnected, size_t maxErrors) {
+  ValidationResult result = {true};
+  auto append = [&result](std::vector<ValidationError> &errors) {
+    result.errors.insert(result.errors.end(), errors.begin(), errors.end());
+  };
+
+  append(findings.busConnections);
+  append(findings.componentConnections);
+
+  if (!hasGround) {
+    result.errors.push_back({ValidationErrorCode::GROUND_COMPONENT_MISSING, ElementKind::NONE, 0});
+  }
+
+  append(findings.simulationMode);
+  append(findings.duplicateBuses);
+  append(findings.duplicateComponents);
+
+  if (!isFullyConnected) {
+    result.errors.push_back(
+        {ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED, ElementKind::NONE, 0});
   }
+
+  if (result.errors.size() > maxErrors) {
+    result.errors.resize(maxErrors);
+    result.isTruncated = true;
+  }
+
+  result.isValid = result.errors.empty();
+  return result;
 }
 
-void CircuitValidator::_validateGround(const Circuit &circuit, ValidationResult &result) {
-  for (const std::shared_ptr<Component> &component : circuit.getComponents()) {
-    if (component->getComponentType() == ComponentType::GROUND) {
-      return;
-    }
+/// Returns the number of errors to report for the options, or SIZE_MAX for all of them.
+static size_t getErrorLimit(const ValidationOptions &options) {
+  if (options.failFast) {
+    return 1;
   }
+  return options.maxErrors == 0 ? SIZE_MAX : options.maxErrors;
+}
 
-  result.isValid = false;
-  result.errors.push_back(
-      {"Ground component is missing.", ValidationErrorCode::GROUND_COMPONENT_MISSING, ""});
+/// Returns a result that holds only the first errors of one check.
+static ValidationResult truncatedResult(std::vector<ValidationError> &errors, size_t maxErrors) {
+  ValidationResult result = {false, std::move(errors), true};
+  result.errors.resize(maxErrors);
+  return result;
 }
 
-void CircuitValidator::_validateSimulationModeCompatibility(const Circuit &circuit,
-                                                            ValidationResult &result) {
-  if (circuit.getSimulationMode() == SimulationMode::DC) {
-    for (const std::shared_ptr<Component> &component : circuit.getComponents()) {
-      switch (component->getComponentType()) {
-      case ComponentType::AC_CURRENT_SOURCE:
-      case ComponentType::AC_VOLTAGE_SOURCE:
-      case ComponentType::CAPACITOR:
-      case ComponentType::INDUCTOR:
-      case ComponentType::UNDEFINED: {
-        result.isValid = false;
-        result.errors.push_back({"Incompatible component for DC simulation mode.",
-                                 ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_DC_SIMULATION,
-                                 "Component - " + component->getId()});
-      }
-      default:
-        break;
+template <typename Lookup, typename Sets>
+static void validateSubcircuitInstances(const Circuit &circuit, const Lookup &findBusIndex,
+                                        Sets &sets, ValidationFindings &findings) {
+  std::unordered_set<const SubcircuitDefinition *> checkedDefinitions;
+
+  for (const auto &instance : circuit.getSubcircuitInstances()) {
+    const SubcircuitDefinition &definition = *instance->getDefinition();
+
+    if (checkedDefinitions.insert(&definition).second) {
+      for (const std::shared_ptr<Component> &component : definition.getComponents()) {
+        checkModeCompatibility(*component, circuit.getSimulationMode(), findings.simulationMode);
       }
     }
-  } else if (circuit.getSimulationMode() == SimulationMode::AC) {
-    for (const std::shared_ptr<Component> &component : circuit.getComponents()) {
-      switch (component->getComponentType()) {
-      case ComponentType::DC_CURRENT_SOURCE:
-      case ComponentType::DC_VOLTAGE_SOURCE:
-      case ComponentType::UNDEFINED: {
-        result.isValid = false;
-        result.errors.push_back({"Incompatible component for AC simulation mode.",
-                                 ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_AC_SIMULATION,
-                                 "Component - " + component->getId()});
-      }
-      default:
-        break;
+
+    const std::vector<uint32_t> &groups = definition.getPortGroups();
+    const std::vector<BusId> &ports = instance->getPortBuses();
+    std::unordered_map<uint32_t, uint32_t> groupBuses;
+
+    for (size_t port = 0; port < ports.size(); port++) {
+      const uint32_t index = findBusIndex(ports[port]);
+      if (index == UINT32_MAX) {
+        continue;
       }
+
+      auto group = groupBuses.emplace(groups[port], index).first;
+      sets.unite(group->second, index);
     }
   }
 }
 
-void CircuitValidator::_validateUniqueIds(const Circuit &circuit, ValidationResult &result) {
-  // Validate unique identifiers among buses.
-  std::unordered_set<BusId> seenBusIds;
+ValidationResult CircuitValidator::isValidCircuit(const Circuit &circuit) {
+  return _isValidCircuitSequential(circuit, SIZE_MAX);
+}
+
+ValidationResult CircuitValidator::isValidCircuit(const Circuit &circuit,
+                                                  const ValidationOptions &options) {
+  const size_t maxErrors = getErrorLimit(options);
+  const size_t size = circuit.getBuses().size() + circuit.getComponents().size();
+  if (options.numberOfThreads == 1 || size < PARALLEL_VALIDATION_THRESHOLD ||
+      maxErrors != SIZE_MAX) {
+    return _isValidCircuitSequential(circuit, maxErrors);
+  }
+
+  ThreadPool pool(options.numberOfThreads);
+  return _isValidCircuitParallel(circuit, pool);
+}
+
+// PRIVATE METHODS
+
+ValidationResult CircuitValidator::_isValidCircuitSequential(const Circuit &circuit,
+                                                             size_t maxErrors) {
+  const std::vector<std::shared_ptr<Bus>> &buses = circuit.getBuses();
+  const std::vector<std::shared_ptr<Component>> &components = circuit.getComponents();
+  const SimulationMode mode = circuit.getSimulationMode();
+  ValidationFindings findings;
+
+  // Buses that connect to a subcircuit port are connected to the components inside it.
+  std::unordered_set<BusId> portBuses;
+  for (const auto &instance : circuit.getSubcircuitInstances()) {
+    portBuses.insert(instance->getPortBuses().begin(), instance->getPortBuses().end());
+  }
+
+  // 1. Sweep over the buses: connections, unique identifiers and a dense index for each bus.
+  std::unordered_map<BusId, uint32_t> busIndices;
+  busIndices.reserve(buses.size());
 
-  for (const std::shared_ptr<Bus> &bus : circuit.getBuses()) {
+  for (const std::shared_ptr<Bus> &bus : buses) {
     const BusId busId = bus->getId();
 
-    if (seenBusIds.find(busId) != seenBusIds.end()) {
-      result.isValid = false;
-      result.errors.push_back({"Duplicate bus ID detected.",
-                               ValidationErrorCode::DUPLICATE_IDENTIFIER, "Bus - " + busId});
-    } else {
-      seenBusIds.insert(busId);
+    if (!bus->isConnected() && portBuses.find(busId) == portBuses.end()) {
+      findings.busConnections.push_back(unconnectedBusError(*bus));
+
+      // These errors come first, so once there are more of them than the limit the rest does not
+      // matter.
+      if (findings.busConnections.size() > maxErrors) {
+        return truncatedResult(findings.busConnections, maxErrors);
+      }
+    }
+
+    if (!busIndices.emplace(busId, static_cast<uint32_t>(busIndices.size())).second) {
+      findings.duplicateBuses.push_back(duplicateBusError(*bus));
     }
   }
 
-  // Validate unique identifiers among components.
-  std::unordered_set<BusId> seenComponentIds;
+  auto findBusIndex = [&busIndices](BusId id) {
+    auto it = busIndices.find(id);
+    return it == busIndices.end() ? UINT32_MAX : it->second;
+  };
 
-  for (const std::shared_ptr<Component> &component : circuit.getComponents()) {
-    const BusId componentId = component->getId();
+  // 2. Sweep over the components: connections, ground, simulation mode and unique identifiers.
+  std::unordered_set<ComponentId> seenComponentIds;
+  seenComponentIds.reserve(components.size());
+  bool hasGround = false;
 
-    if (seenComponentIds.find(componentId) != seenComponentIds.end()) {
-      result.isValid = false;
-      result.errors.push_back({"Duplicate component ID detected.",
-                               ValidationErrorCode::DUPLICATE_IDENTIFIER,
-                               "Component - " + componentId});
-    } else {
-      seenComponentIds.insert(componentId);
+  for (const std::shared_ptr<Component> &component : components) {
+    if (!component->isConnected()) {
+      findings.componentConnections.push_back(unconnectedComponentError(*component));
+
+      if (findings.busConnections.size() + findings.componentConnections.size() > maxErrors) {
+        findings.busConnections.insert(findings.busConnections.end(),
+                                       findings.componentConnections.begin(),
+                                       findings.componentConnections.end());
+        return truncatedResult(findings.busConnections, maxErrors);
+      }
+    }
+
+    hasGround = hasGround || component->getComponentType() == ComponentType::GROUND;
+    checkModeCompatibility(*component, mode, findings.simulationMode);
+
+    if (!seenComponentIds.insert(component->getId()).second) {
+      findings.duplicateComponents.push_back(duplicateComponentError(*component));
     }
   }
+
+  // 3. Join every bus with its neighbors. The scratch space is indexed by the dense bus indices,
+  // so the walk does not allocate.
+  DisjointSet sets(static_cast<uint32_t>(busIndices.size()));
+  NeighborScratch scratch(static_cast<uint32_t>(busIndices.size()));
+  auto indexOf = [&findBusIndex](const Bus &bus) { return findBusIndex(bus.getId()); };
+  for (const std::shared_ptr<Bus> &bus : buses) {
+    const uint32_t index = findBusIndex(bus->getId());
+    bus->forEachNeighborBus(scratch, indexOf,
+                            [&sets, index](const std::shared_ptr<Bus> &, uint32_t neighbor) {
+                              sets.unite(index, neighbor);
+                            });
+  }
+
+  // 4. Subcircuit instances: every definition is checked once, and ports that are connected
+  // inside the definition join their parent buses.
+  validateSubcircuitInstances(circuit, findBusIndex, sets, findings);
+
+  // 5. Report the errors in the order of the checks. Duplicate buses can never all be reached,
+  // as each identifier is counted once.
+  bool isFullyConnected =
+      buses.empty() || (sets.getNumberOfSets() == 1 && busIndices.size() == buses.size());
+  return collectErrors(findings, hasGround, isFullyConnected, maxErrors);
 }
 
-static void dfs(const std::weak_ptr<Bus> &bus, const Circuit &circuit,
-                std::unordered_set<int> &visited) {
-  if (auto b = bus.lock()) {
-    if (visited.count(b->getId()))
-      return;
+ValidationResult CircuitValidator::_isValidCircuitParallel(const Circuit &circuit,
+                                                           ThreadPool &pool) {
+  const std::vector<std::shared_ptr<Bus>> &buses = circuit.getBuses();
+  const std::vector<std::shared_ptr<Component>> &components = circuit.getComponents();
+  const SimulationMode mode = circuit.getSimulationMode();
+
+  // Elements are split into contiguous chunks, several per thread for load balancing.
+  // Identifiers are split into shards by value, so that each shard can be checked for
+  // duplicates without locking. The chunk passes sort the element indices into the shards, so
+  // each shard only walks its own identifiers.
+  const size_t numberOfChunks = static_cast<size_t>(pool.getNumberOfThreads()) * 4;
+  const uint32_t numberOfShards = pool.getNumberOfThreads();
+  auto chunkBegin = [numberOfChunks](size_t chunk, size_t count) {
+    return count * chunk / numberOfChunks;
+  };
+
+  std::unordered_set<BusId> portBuses;
+  for (const auto &instance : circuit.getSubcircuitInstances()) {
+    portBuses.insert(instance->getPortBuses().begin(), instance->getPortBuses().end());
+  }
+
+  // 1. Buses: connections and identifiers, one chunk per task.
+  std::vector<BusId> busIds(buses.size());
+  std::vector<std::vector<ValidationError>> unconnectedBuses(numberOfChunks);
+  std::vector<std::vector<std::vector<uint32_t>>> busShards(
+      numberOfChunks, std::vector<std::vector<uint32_t>>(numberOfShards));
+
+  pool.run(numberOfChunks, [&](size_t chunk) {
+    for (size_t k = chunkBegin(chunk, buses.size()); k < chunkBegin(chunk + 1, buses.size());
+         k++) {
+      busIds[k] = buses[k]->getId();
+      busShards[chunk][busIds[k] % numberOfShards].push_back(static_cast<uint32_t>(k));
+      if (!buses[k]->isConnected() && portBuses.find(busIds[k]) == portBuses.end()) {
+        unconnectedBuses[chunk].push_back(unconnectedBusError(*buses[k]));
+      }
+    }
+  });
+
+  // 2. Bus identifiers: index of the first bus with each identifier, and later duplicates.
+  // Chunks are visited in order, so each shard sees its buses in ascending index order.
+  std::vector<std::unordered_map<BusId, uint32_t>> busIndices(numberOfShards);
+  std::vector<std::vector<uint32_t>> duplicateBuses(numberOfShards);
+
+  pool.run(numberOfShards, [&](size_t shard) {
+    for (size_t chunk = 0; chunk < numberOfChunks; chunk++) {
+      for (uint32_t k : busShards[chunk][shard]) {
+        if (!busIndices[shard].emplace(busIds[k], k).second) {
+          duplicateBuses[shard].push_back(k);
+        }
+      }
+    }
+  });
+
+  auto findBusIndex = [&busIndices, numberOfShards](BusId id) {
+    const auto &shard = busIndices[id % numberOfShards];
+    auto it = shard.find(id);
+    return it == shard.end() ? UINT32_MAX : it->second;
+  };
+
+  // 3. Components: connections, ground, simulation mode and connectivity.
+  ConcurrentDisjointSet sets(static_cast<uint32_t>(buses.size()));
+  std::vector<ComponentId> componentIds(components.size());
+  std::vector<std::vector<ValidationError>> unconnectedComponents(numberOfChunks);
+  std::vector<std::vector<ValidationError>> incompatibleComponents(numberOfChunks);
+  std::vector<char> groundFound(numberOfChunks, 0);
+  std::vector<std::vector<std::vector<uint32_t>>> componentShards(
+      numberOfChunks, std::vector<std::vector<uint32_t>>(numberOfShards));
+
+  pool.run(numberOfChunks, [&](size_t chunk) {
+    for (size_t k = chunkBegin(chunk, components.size());
+         k < chunkBegin(chunk + 1, components.size()); k++) {
+      const Component &component = *components[k];
+      componentIds[k] = component.getId();
+      componentShards[chunk][componentIds[k] % numberOfShards].push_back(
+          static_cast<uint32_t>(k));
+
+      if (!component.isConnected()) {
+        unconnectedComponents[chunk].push_back(unconnectedComponentError(component));
+      }
 
-    visited.insert(b->getId());
-    for (const auto &neighbor : b->getNeighborBuses()) {
-      dfs(neighbor, circuit, visited);
+      if (component.getComponentType() == ComponentType::GROUND) {
+        groundFound[chunk] = 1;
+      }
+
+      checkModeCompatibility(component, mode, incompatibleComponents[chunk]);
+      uniteConnectedBuses(component, findBusIndex, sets);
+    }
+  });
+
+  // 4. Component identifiers.
+  std::vector<std::vector<uint32_t>> duplicateComponents(numberOfShards);
+
+  pool.run(numberOfShards, [&](size_t shard) {
+    std::unordered_set<ComponentId> seen;
+    for (size_t chunk = 0; chunk < numberOfChunks; chunk++) {
+      for (uint32_t k : componentShards[chunk][shard]) {
+        if (!seen.insert(componentIds[k]).second) {
+          duplicateComponents[shard].push_back(k);
+        }
+      }
+    }
+  });
+
+  // 5. Merge the partial results in a fixed order, so that the result does not depend on the
+  // scheduling of the tasks.
+  ValidationFindings findings;
+  for (size_t chunk = 0; chunk < numberOfChunks; chunk++) {
+    for (ValidationError &error : unconnectedBuses[chunk]) {
+      findings.busConnections.push_back(std::move(error));
+    }
+    for (ValidationError &error : unconnectedComponents[chunk]) {
+      findings.componentConnections.push_back(std::move(error));
+    }
+    for (ValidationError &error : incompatibleComponents[chunk]) {
+      findings.simulationMode.push_back(std::move(error));
     }
   }
-}
 
-void CircuitValidator::_validateConnectivity(const Circuit &circuit, ValidationResult &result) {
-  std::unordered_set<int> visited;
-  if (circuit.getBuses().empty())
-    return;
+  std::vector<uint32_t> duplicates;
+  for (const std::vector<uint32_t> &shard : duplicateBuses) {
+    duplicates.insert(duplicates.end(), shard.begin(), shard.end());
+  }
+  std::sort(duplicates.begin(), duplicates.end());
+  for (uint32_t k : duplicates) {
+    findings.duplicateBuses.push_back(duplicateBusError(*buses[k]));
+  }
+
+  duplicates.clear();
+  for (const std::vector<uint32_t> &shard : duplicateComponents) {
+    duplicates.insert(duplicates.end(), shard.begin(), shard.end());
+  }
+  std::sort(duplicates.begin(), duplicates.end());
+  for (uint32_t k : duplicates) {
+    findings.duplicateComponents.push_back(duplicateComponentError(*components[k]));
+  }
 
-  // Start DFS from the first bus to check full connectivity
-  dfs(std::weak_ptr<Bus>(circuit.getBuses().at(0)), circuit, visited);
+  // 6. Subcircuit instances are few, so they are handled on this thread.
+  validateSubcircuitInstances(circuit, findBusIndex, sets, findings);
 
-  if (visited.size() != circuit.getBuses().size()) {
-    result.isValid = false;
-    result.errors.push_back({"Circuit contains buses that are not reachable from one another.",
-                             ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED, ""});
+  // 7. The circuit is fully connected if the identifiers are unique and only the first bus is
+  // still a root. Every other root is a bus that no union reached.
+  bool isFullyConnected = findings.duplicateBuses.empty();
+  if (isFullyConnected && !buses.empty()) {
+    std::vector<char> extraRoots(numberOfChunks, 0);
+    pool.run(numberOfChunks, [&](size_t chunk) {
+      for (size_t k = std::max<size_t>(1, chunkBegin(chunk, buses.size()));
+           k < chunkBegin(chunk + 1, buses.size()); k++) {
+        if (sets.find(static_cast<uint32_t>(k)) == k) {
+          extraRoots[chunk] = 1;
+          return;
+        }
+      }
+    });
+    isFullyConnected = std::find(extraRoots.begin(), extraRoots.end(), 1) == extraRoots.end();
   }
+
+  bool hasGround = std::find(groundFound.begin(), groundFound.end(), 1) != groundFound.end();
+  return collectErrors(findings, hasGround, isFullyConnected, SIZE_MAX);
 }
 
-} // namespace ocira::core
\ No newline at end of file
+} // namespace ocira::core
@@ -25,6 +25,7 @@
 //==============================================================================
 // Revision History:
 // - 2025-09-17 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add static phasor helper.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -51,9 +52,13 @@ void ACCurrentSource::setAmplitude(float amplitude) noexcept { this->m_amplitude
 void ACCurrentSource::setPhase(float phase) noexcept { this->m_phase = phase; }
 
 std::complex<float> ACCurrentSource::getPhasor() const noexcept {
-  float angle = this->m_phase * M_PI / 180.0;
-  float real = this->m_amplitude * cos(angle);
-  float imag = this->m_amplitude * sin(angle);
+  return computePhasor(this->m_amplitude, this->m_phase);
+}
+
+std::complex<float> ACCurrentSource::computePhasor(float amplitude, float phase) noexcept {
+  float angle = phase * M_PI / 180.0;
+  float real = amplitude * cos(angle);
+  float imag = amplitude * sin(angle);
   std::complex<float> phasor(real, imag);
   return phasor;
 }
@@ -25,6 +25,8 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add allocation-free neighbor iteration.
+// - 2026-10-19 Martin Vidjeskog: Index the neighbor scratch space by dense bus indices.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -38,6 +40,31 @@
 
 namespace ocira::core::components {
 
+NeighborScratch::NeighborScratch(uint32_t size) : m_epoch(0) { this->m_marks.reserve(size); }
+
+void NeighborScratch::nextEpoch() {
+  this->m_epoch++;
+
+  // Reset the marks when the counter wraps around so that stale marks cannot match.
+  if (this->m_epoch == 0) {
+    std::fill(this->m_marks.begin(), this->m_marks.end(), 0);
+    this->m_epoch = 1;
+  }
+}
+
+bool NeighborScratch::mark(uint32_t index) {
+  if (index >= this->m_marks.size()) {
+    this->m_marks.resize(static_cast<size_t>(index) + 1, 0);
+  }
+
+  if (this->m_marks[index] == this->m_epoch) {
+    return false;
+  }
+
+  this->m_marks[index] = this->m_epoch;
+  return true;
+}
+
 Bus::Bus(BusId id) : m_id(id) { this->m_components = std::vector<std::shared_ptr<Component>>(); }
 
 BusId Bus::getId() const noexcept { return this->m_id; }
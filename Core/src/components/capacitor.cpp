@@ -25,6 +25,7 @@
 //==============================================================================
 // Revision History:
 // - 2025-09-08 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add static admittance helper.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -56,8 +57,12 @@ std::complex<float> Capacitor::getImpedance(const float frequency) const {
 }
 
 std::complex<float> Capacitor::getAdmittance(const float frequency) const {
+  return computeAdmittance(this->m_capacitance, frequency);
+}
+
+std::complex<float> Capacitor::computeAdmittance(const float capacitance, const float frequency) {
   const float omega = 2.0f * static_cast<float>(M_PI) * frequency;
-  return std::complex<float>(0.0f, omega * m_capacitance);
+  return std::complex<float>(0.0f, omega * capacitance);
 }
 
 void Capacitor::setCapacitance(const float capacitance) noexcept {
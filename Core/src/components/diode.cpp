@@ -0,0 +1,68 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        diode.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Diode component model.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "diode.hpp"
+#include <cmath>
+
+namespace ocira::core::components {
+
+Diode::Diode(ComponentId id, float saturationCurrent, float emissionCoefficient)
+    : Component(id) {
+  this->m_type = ComponentType::DIODE;
+  this->m_saturationCurrent = saturationCurrent;
+  this->m_emissionCoefficient = emissionCoefficient;
+}
+
+float Diode::getSaturationCurrent() const noexcept { return this->m_saturationCurrent; }
+
+float Diode::getEmissionCoefficient() const noexcept { return this->m_emissionCoefficient; }
+
+double Diode::getCurrent(double voltage) const noexcept {
+  const double thermalVoltage = this->m_emissionCoefficient * THERMAL_VOLTAGE;
+  return this->m_saturationCurrent * std::expm1(voltage / thermalVoltage);
+}
+
+double Diode::getConductance(double voltage) const noexcept {
+  const double thermalVoltage = this->m_emissionCoefficient * THERMAL_VOLTAGE;
+  return this->m_saturationCurrent / thermalVoltage * std::exp(voltage / thermalVoltage);
+}
+
+void Diode::setSaturationCurrent(float saturationCurrent) noexcept {
+  this->m_saturationCurrent = saturationCurrent;
+}
+
+void Diode::setEmissionCoefficient(float emissionCoefficient) noexcept {
+  this->m_emissionCoefficient = emissionCoefficient;
+}
+
+} // namespace ocira::core::components
@@ -25,6 +25,7 @@
 //==============================================================================
 // Revision History:
 // - 2025-09-14 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add static admittance helper.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -47,15 +48,20 @@ std::complex<float> Inductor::getImpedance(const float frequency) const {
 }
 
 std::complex<float> Inductor::getAdmittance(const float frequency) const {
+  return computeAdmittance(this->m_inductance, frequency);
+}
+
+std::complex<float> Inductor::computeAdmittance(const float inductance, const float frequency) {
   if (frequency == 0.0f) {
     throw std::runtime_error("Admittance of inductor is undefined for zero frequency.");
   }
 
-  if (this->m_inductance == 0.0f) {
+  if (inductance == 0.0f) {
     throw std::runtime_error("Admittance of inductor is undefined for zero inductance.");
   }
 
-  std::complex<float> impedance = getImpedance(frequency);
+  const float omega = 2.0f * M_PI * frequency;
+  std::complex<float> impedance(0.0f, omega * inductance);
   return 1.0f / impedance;
 }
 
@@ -25,6 +25,7 @@
 //==============================================================================
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Add static conductance helper.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -43,12 +44,14 @@ Resistor::Resistor(ComponentId id, float resistance) : Component(id) {
 
 float Resistor::getResistance() const noexcept { return this->m_resistance; }
 
-float Resistor::getConductance() const {
-  if (this->m_resistance == 0.0f) {
+float Resistor::getConductance() const { return computeConductance(this->m_resistance); }
+
+float Resistor::computeConductance(float resistance) {
+  if (resistance == 0.0f) {
     throw std::runtime_error("Conductance is undefined for zero resistance.");
   }
 
-  return 1.0f / this->m_resistance;
+  return 1.0f / resistance;
 }
 
 void Resistor::setResistance(float resistance) noexcept { this->m_resistance = resistance; }
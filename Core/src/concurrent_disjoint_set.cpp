@@ -0,0 +1,86 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        concurrent_disjoint_set.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Lock-free disjoint-set (union-find) structure.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "concurrent_disjoint_set.hpp"
+#include <utility>
+
+namespace ocira::core {
+
+ConcurrentDisjointSet::ConcurrentDisjointSet(uint32_t size)
+    : m_parents(new std::atomic<uint32_t>[size]), m_size(size) {
+  for (uint32_t k = 0; k < size; k++) {
+    this->m_parents[k].store(k, std::memory_order_relaxed);
+  }
+}
+
+uint32_t ConcurrentDisjointSet::find(uint32_t index) {
+  while (true) {
+    uint32_t parent = this->m_parents[index].load(std::memory_order_acquire);
+    if (parent == index) {
+      return index;
+    }
+
+    // Path halving. A failed exchange only means that another thread got there first.
+    uint32_t grandparent = this->m_parents[parent].load(std::memory_order_acquire);
+    if (parent != grandparent) {
+      this->m_parents[index].compare_exchange_weak(parent, grandparent,
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed);
+    }
+    index = grandparent;
+  }
+}
+
+bool ConcurrentDisjointSet::unite(uint32_t a, uint32_t b) {
+  while (true) {
+    a = this->find(a);
+    b = this->find(b);
+    if (a == b) {
+      return false;
+    }
+
+    // Always hang the larger root below the smaller one, which keeps the structure acyclic.
+    if (a < b) {
+      std::swap(a, b);
+    }
+
+    uint32_t expected = a;
+    if (this->m_parents[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) {
+      return true;
+    }
+  }
+}
+
+uint32_t ConcurrentDisjointSet::getSize() const noexcept { return this->m_size; }
+
+} // namespace ocira::core
@@ -0,0 +1,219 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        contingency_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Single-outage (N-1) contingency analysis by rank-one updates.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Split the work with ThreadPool::runRanges.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+#include "contingency_analysis.hpp"
+#include "ac_current_source.hpp"
+#include "capacitor.hpp"
+#include "circuit.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include "dc_current_source.hpp"
+#include "inductor.hpp"
+#include "resistor.hpp"
+#include <algorithm>
+#include <complex>
+#include <stdexcept>
+#include <utility>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+namespace {
+
+/// @brief An outaged component. Branches have an admittance between two bus numbers, current
+/// sources the entries of J they set.
+struct Outage {
+  BusNumber first;
+  BusNumber second;
+  std::complex<double> admittance;
+  std::vector<std::pair<arma::uword, std::complex<double>>> currents;
+};
+
+/// @brief Returns entry n - 1 of a vector, or zero for bus number 0, which is ground.
+std::complex<double> getEntry(const arma::cx_vec &x, BusNumber n) {
+  return n != 0 ? x(n - 1) : std::complex<double>(0.0);
+}
+
+} // namespace
+
+ContingencyResult ContingencyAnalysis::run(const std::shared_ptr<const Circuit> &circuit,
+                                           const ContingencyOptions &options, ThreadPool &pool) {
+  if (circuit->getSimulationMode() == SimulationMode::TRANSIENT) {
+    throw std::runtime_error("Contingency analysis needs a DC or AC circuit!");
+  }
+  if (!(options.minimumVoltage <= options.maximumVoltage) || !(options.islandingTolerance > 0.0)) {
+    throw std::runtime_error("Invalid contingency options!");
+  }
+
+  ValidationOptions validationOptions;
+  validationOptions.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, validationOptions).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+
+  // 1. One transformation, factorization and base solve.
+  const CircuitTransformer transformer{CircuitSnapshot(circuit)};
+  const auto &busIdMap = transformer.getBusIdMap();
+  const CircuitFactorization factorization(*transformer.getAdmittanceMatrix());
+  const arma::cx_vec x = factorization.solve(*transformer.getCurrentVector());
+  const float frequency = circuit->getFrequency();
+
+  ContingencyResult result;
+  std::vector<BusNumber> rows;
+  for (const auto &bus : circuit->getBuses()) {
+    result.busIds.push_back(bus->getId());
+    rows.push_back(busIdMap.at(bus->getId()));
+  }
+  result.baseVoltages.set_size(rows.size());
+  for (size_t k = 0; k < rows.size(); k++) {
+    result.baseVoltages(k) = getEntry(x, rows[k]);
+  }
+
+  // 2. Collect the outages.
+  std::vector<Outage> outages;
+  for (const auto &component : circuit->getComponents()) {
+    const ComponentType type = component->getComponentType();
+    if (type != ComponentType::RESISTOR && type != ComponentType::CAPACITOR &&
+        type != ComponentType::INDUCTOR && type != ComponentType::DC_CURRENT_SOURCE &&
+        type != ComponentType::AC_CURRENT_SOURCE) {
+      continue;
+    }
+
+    const auto &connections = component->getConnections();
+    auto b1 = connections[0].bus.lock();
+    auto b2 = connections[1].bus.lock();
+    if (!b1 || !b2) {
+      throw std::runtime_error("Unexpected error! Pointer not existing!");
+    }
+
+    Outage outage{busIdMap.at(b1->getId()), busIdMap.at(b2->getId()), 0.0, {}};
+    std::complex<double> current = 0.0;
+    switch (type) {
+    case ComponentType::RESISTOR:
+      outage.admittance = Resistor::computeConductance(
+          std::static_pointer_cast<Resistor>(component)->getResistance());
+      break;
+    case ComponentType::CAPACITOR:
+      outage.admittance = std::complex<double>(
+          std::static_pointer_cast<Capacitor>(component)->getAdmittance(frequency));
+      break;
+    case ComponentType::INDUCTOR:
+      outage.admittance = std::complex<double>(
+          std::static_pointer_cast<Inductor>(component)->getAdmittance(frequency));
+      break;
+    case ComponentType::DC_CURRENT_SOURCE:
+      current = std::static_pointer_cast<DCCurrentSource>(component)->getAmps();
+      break;
+    default:
+      current =
+          std::complex<double>(std::static_pointer_cast<ACCurrentSource>(component)->getPhasor());
+      break;
+    }
+
+    // Current sources inject into the bus at their positive terminal.
+    const BusNumber buses[2] = {outage.first, outage.second};
+    for (size_t k = 0; k < 2; k++) {
+      if (current != 0.0 && buses[k] != 0) {
+        outage.currents.emplace_back(buses[k] - 1, connections[k].role == TerminalRole::POSITIVE
+                                                       ? current
+                                                       : -current);
+      }
+    }
+    result.componentIds.push_back(component->getId());
+    outages.push_back(std::move(outage));
+  }
+
+  // 3. Solve the outages. Each task takes a contiguous range and writes its own columns.
+  const size_t numberOfOutages = outages.size();
+  result.voltages.zeros(rows.size(), numberOfOutages);
+  std::vector<char> isIslanding(numberOfOutages, 0);
+  std::vector<char> violatesLimits(numberOfOutages, 0);
+
+  pool.runRanges(numberOfOutages, [&](size_t, size_t begin, size_t end) {
+    arma::cx_vec rhs(x.n_elem);
+    arma::cx_vec solution;
+
+    for (size_t m = begin; m < end; m++) {
+      const Outage &outage = outages[m];
+      rhs.zeros();
+      if (outage.currents.empty()) {
+        // Branch: Sherman-Morrison update with a = e_first - e_second.
+        if (outage.first != 0) {
+          rhs(outage.first - 1) += 1.0;
+        }
+        if (outage.second != 0) {
+          rhs(outage.second - 1) -= 1.0;
+        }
+        const arma::cx_vec z = factorization.solve(rhs);
+        const std::complex<double> denominator =
+            1.0 - outage.admittance * (getEntry(z, outage.first) - getEntry(z, outage.second));
+        if (std::abs(denominator) < options.islandingTolerance) {
+          isIslanding[m] = 1;
+          continue;
+        }
+        const std::complex<double> scale =
+            outage.admittance * (getEntry(x, outage.first) - getEntry(x, outage.second)) /
+            denominator;
+        solution = x + scale * z;
+      } else {
+        // Current source: remove its share of the solution.
+        for (const auto &[row, value] : outage.currents) {
+          rhs(row) += value;
+        }
+        solution = x - factorization.solve(rhs);
+      }
+
+      std::complex<double> *column = result.voltages.colptr(m);
+      for (size_t k = 0; k < rows.size(); k++) {
+        column[k] = getEntry(solution, rows[k]);
+        const double magnitude = std::abs(column[k]);
+        if (rows[k] != 0 &&
+            (magnitude < options.minimumVoltage || magnitude > options.maximumVoltage)) {
+          violatesLimits[m] = 1;
+        }
+      }
+    }
+  });
+
+  result.isIslanding.assign(isIslanding.begin(), isIslanding.end());
+  result.violatesLimits.assign(violatesLimits.begin(), violatesLimits.end());
+  result.numberOfIslandingOutages = std::count(isIslanding.begin(), isIslanding.end(), 1);
+  result.numberOfViolatingOutages = std::count(violatesLimits.begin(), violatesLimits.end(), 1);
+  return result;
+}
+
+} // namespace ocira::core
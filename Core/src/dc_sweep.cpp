@@ -0,0 +1,171 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        dc_sweep.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: DC analysis of a circuit over a grid of source values.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Read voltage source rows from CircuitTransformer.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "dc_sweep.hpp"
+#include "circuit.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include "dc_current_source.hpp"
+#include "dc_voltage_source.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+std::vector<float> DCSweep::linearValues(float start, float stop, uint32_t numberOfPoints) {
+  if (numberOfPoints == 0) {
+    throw std::runtime_error("Invalid linear value range!");
+  }
+
+  std::vector<float> values(numberOfPoints, start);
+  const double step = numberOfPoints > 1 ? (double(stop) - start) / (numberOfPoints - 1) : 0.0;
+  for (uint32_t k = 1; k < numberOfPoints; k++) {
+    values[k] = static_cast<float>(start + step * k);
+  }
+  return values;
+}
+
+DCSweepResult DCSweep::run(const std::shared_ptr<const Circuit> &circuit,
+                           const std::vector<DCSweepAxis> &axes) {
+  if (axes.empty()) {
+    throw std::runtime_error("DC sweep has no axes!");
+  }
+  for (size_t a = 0; a < axes.size(); a++) {
+    for (size_t b = 0; b < a; b++) {
+      if (axes[a].sourceId == axes[b].sourceId) {
+        throw std::runtime_error("Source is swept twice!");
+      }
+    }
+  }
+  if (circuit->getSimulationMode() != SimulationMode::DC) {
+    throw std::runtime_error("DC sweeps need a DC circuit!");
+  }
+
+  ValidationOptions options;
+  options.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, options).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+
+  // 1. Transform and factorize once.
+  const CircuitTransformer transformer{CircuitSnapshot(circuit)};
+  const arma::cx_vec &nominalJ = *transformer.getCurrentVector();
+  const CircuitFactorization factorization(*transformer.getAdmittanceMatrix());
+  const auto &busIdMap = transformer.getBusIdMap();
+
+  // 2. Find the entries of J that each swept source sets, with the nominal value of the source.
+
+  struct SourceEntries {
+    float nominal;
+    std::vector<std::pair<arma::uword, double>> entries;
+    bool isFound;
+  };
+  std::vector<SourceEntries> sources(axes.size(), {0.0f, {}, false});
+
+  for (const auto &component : circuit->getComponents()) {
+    const ComponentType type = component->getComponentType();
+
+    for (size_t a = 0; a < axes.size(); a++) {
+      if (axes[a].sourceId != component->getId()) {
+        continue;
+      }
+      sources[a].isFound = true;
+
+      if (type == ComponentType::DC_VOLTAGE_SOURCE) {
+        sources[a].nominal = std::static_pointer_cast<DCVoltageSource>(component)->getVolts();
+        sources[a].entries.emplace_back(transformer.getVoltageSourceRow(component->getId()), 1.0);
+      } else if (type == ComponentType::DC_CURRENT_SOURCE) {
+        // Current sources inject into the bus at their positive terminal.
+        sources[a].nominal = std::static_pointer_cast<DCCurrentSource>(component)->getAmps();
+        for (const Connection &connection : component->getConnections()) {
+          auto bus = connection.bus.lock();
+          if (!bus) {
+            throw std::runtime_error("Unexpected error! Pointer not existing!");
+          }
+          const BusNumber number = busIdMap.at(bus->getId());
+          if (number != 0) {
+            sources[a].entries.emplace_back(
+                number - 1, connection.role == TerminalRole::POSITIVE ? 1.0 : -1.0);
+          }
+        }
+      } else {
+        throw std::runtime_error("Only DC voltage and current sources can be swept!");
+      }
+    }
+  }
+
+  uint64_t numberOfPoints = 1;
+  for (size_t a = 0; a < axes.size(); a++) {
+    if (!sources[a].isFound) {
+      throw std::runtime_error("Swept source is not part of the circuit!");
+    }
+    if (axes[a].values.empty()) {
+      throw std::runtime_error("DC sweep axis has no values!");
+    }
+    numberOfPoints *= axes[a].values.size();
+  }
+
+  // 3. Build the right-hand side of every grid point and solve them as one block.
+  arma::cx_mat B(nominalJ.n_elem, numberOfPoints);
+  for (uint64_t point = 0; point < numberOfPoints; point++) {
+    std::copy(nominalJ.memptr(), nominalJ.memptr() + nominalJ.n_elem, B.colptr(point));
+    uint64_t remainder = point;
+    for (size_t a = axes.size(); a-- > 0;) {
+      const size_t index = remainder % axes[a].values.size();
+      remainder /= axes[a].values.size();
+      const double change = double(axes[a].values[index]) - sources[a].nominal;
+      for (const auto &[row, sign] : sources[a].entries) {
+        B(row, point) += sign * change;
+      }
+    }
+  }
+
+  DCSweepResult result;
+  result.axes = axes;
+  result.solutions = factorization.solve(B);
+  return result;
+}
+
+DCSweepResult DCSweep::run(const std::shared_ptr<const Circuit> &circuit, ComponentId sourceId,
+                           const std::vector<float> &values) {
+  return run(circuit, std::vector<DCSweepAxis>{{sourceId, values}});
+}
+
+} // namespace ocira::core
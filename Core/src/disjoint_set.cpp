@@ -0,0 +1,83 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        disjoint_set.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Disjoint-set (union-find) structure over dense indices.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "disjoint_set.hpp"
+#include <numeric>
+#include <utility>
+
+namespace ocira::core {
+
+DisjointSet::DisjointSet(uint32_t size)
+    : m_parents(size), m_sizes(size, 1), m_numberOfSets(size) {
+  std::iota(this->m_parents.begin(), this->m_parents.end(), 0);
+}
+
+uint32_t DisjointSet::add() {
+  uint32_t index = static_cast<uint32_t>(this->m_parents.size());
+  this->m_parents.push_back(index);
+  this->m_sizes.push_back(1);
+  this->m_numberOfSets++;
+  return index;
+}
+
+uint32_t DisjointSet::find(uint32_t index) {
+  while (this->m_parents[index] != index) {
+    this->m_parents[index] = this->m_parents[this->m_parents[index]];
+    index = this->m_parents[index];
+  }
+  return index;
+}
+
+bool DisjointSet::unite(uint32_t a, uint32_t b) {
+  a = this->find(a);
+  b = this->find(b);
+  if (a == b) {
+    return false;
+  }
+
+  if (this->m_sizes[a] < this->m_sizes[b]) {
+    std::swap(a, b);
+  }
+  this->m_parents[b] = a;
+  this->m_sizes[a] += this->m_sizes[b];
+  this->m_numberOfSets--;
+  return true;
+}
+
+uint32_t DisjointSet::getSize() const noexcept {
+  return static_cast<uint32_t>(this->m_parents.size());
+}
+
+uint32_t DisjointSet::getNumberOfSets() const noexcept { return this->m_numberOfSets; }
+
+} // namespace ocira::core
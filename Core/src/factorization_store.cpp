@@ -0,0 +1,200 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        factorization_store.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Versioned on-disk store of admittance matrix factorizations.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Give every save its own temporary file.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "factorization_store.hpp"
+#include <atomic>
+#include <complex>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace ocira::core {
+
+namespace {
+
+constexpr char MAGIC[4] = {'O', 'C', 'F', 'A'};
+constexpr uint32_t BYTE_ORDER_MARKER = 0x01020304;
+
+/// @brief Fixed-size file header. The factors follow it directly.
+struct FileHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t reserved;
+  uint64_t topology;
+  uint64_t admittance;
+  uint64_t size;
+};
+
+template <typename T> void writeValues(std::ofstream &stream, const T *values, size_t count) {
+  stream.write(reinterpret_cast<const char *>(values),
+               static_cast<std::streamsize>(count * sizeof(T)));
+}
+
+template <typename T> bool readValues(std::ifstream &stream, T *values, size_t count) {
+  stream.read(reinterpret_cast<char *>(values), static_cast<std::streamsize>(count * sizeof(T)));
+  return static_cast<bool>(stream);
+}
+
+/// @brief Returns a name for a temporary file next to path that no other writer uses.
+/// The name holds the process ID, a random token drawn once per process, for processes on other
+/// hosts that share the directory, and a counter that differs for every call in the process.
+std::string getTemporaryPath(const std::string &path) {
+  static std::atomic<uint64_t> counter{0};
+  static const uint64_t token = [] {
+    std::random_device device;
+    return (uint64_t(device()) << 32) ^ device();
+  }();
+#ifdef _WIN32
+  const long long processId = _getpid();
+#else
+  const long long processId = getpid();
+#endif
+  return path + "." + std::to_string(processId) + "." + std::to_string(token) + "." +
+         std::to_string(counter.fetch_add(1)) + ".tmp";
+}
+
+} // namespace
+
+FactorizationStore::FactorizationStore(std::string directory) : m_directory(std::move(directory)) {
+  std::error_code error;
+  std::filesystem::create_directories(this->m_directory, error);
+  if (error || !std::filesystem::is_directory(this->m_directory)) {
+    throw std::runtime_error("Could not create factorization store directory!");
+  }
+}
+
+std::string FactorizationStore::getPath(const CircuitFingerprint &fingerprint) const {
+  char name[32];
+  std::snprintf(name, sizeof(name), "%016llx.ocfa",
+                static_cast<unsigned long long>(fingerprint.admittance));
+  return (std::filesystem::path(this->m_directory) / name).string();
+}
+
+bool FactorizationStore::save(const CircuitFingerprint &fingerprint,
+                              const CircuitFactorization &factorization) const {
+  const uint64_t n = factorization.getSize();
+  FileHeader header = {{MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3]},
+                       FORMAT_VERSION,
+                       BYTE_ORDER_MARKER,
+                       0,
+                       fingerprint.topology,
+                       fingerprint.admittance,
+                       n};
+
+  std::vector<uint64_t> permutation(factorization.getPermutation().begin(),
+                                    factorization.getPermutation().end());
+
+  // Write next to the final file and rename, so readers see either the old or the new file.
+  const std::string path = this->getPath(fingerprint);
+  const std::string temporary = getTemporaryPath(path);
+  {
+    std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+      return false;
+    }
+    writeValues(stream, &header, 1);
+    writeValues(stream, permutation.data(), permutation.size());
+    writeValues(stream, factorization.getLower().memptr(), n * n);
+    writeValues(stream, factorization.getUpper().memptr(), n * n);
+    if (!stream.flush()) {
+      stream.close();
+      std::filesystem::remove(temporary);
+      return false;
+    }
+  }
+
+  std::error_code error;
+  std::filesystem::rename(temporary, path, error);
+  if (error) {
+    std::filesystem::remove(temporary, error);
+    return false;
+  }
+  return true;
+}
+
+std::shared_ptr<const CircuitFactorization>
+FactorizationStore::load(const CircuitFingerprint &fingerprint) const {
+  std::ifstream stream(this->getPath(fingerprint), std::ios::binary);
+  if (!stream) {
+    return nullptr;
+  }
+
+  FileHeader header;
+  if (!readValues(stream, &header, 1) ||
+      std::char_traits<char>::compare(header.magic, MAGIC, 4) != 0 ||
+      header.version != FORMAT_VERSION || header.byteOrder != BYTE_ORDER_MARKER ||
+      header.topology != fingerprint.topology || header.admittance != fingerprint.admittance) {
+    return nullptr;
+  }
+
+  // Check the file size before allocating, so a corrupt size field cannot exhaust memory.
+  const uint64_t n = header.size;
+  const std::streamoff payloadStart = stream.tellg();
+  stream.seekg(0, std::ios::end);
+  const uint64_t payloadSize = static_cast<uint64_t>(stream.tellg() - payloadStart);
+  if (n == 0 || payloadSize != n * sizeof(uint64_t) + 2 * n * n * sizeof(std::complex<double>)) {
+    return nullptr;
+  }
+  stream.seekg(payloadStart);
+
+  std::vector<uint64_t> permutation(n);
+  arma::cx_mat L(n, n);
+  arma::cx_mat U(n, n);
+  if (!readValues(stream, permutation.data(), n) || !readValues(stream, L.memptr(), n * n) ||
+      !readValues(stream, U.memptr(), n * n)) {
+    return nullptr;
+  }
+
+  try {
+    return std::make_shared<const CircuitFactorization>(
+        std::move(L), std::move(U),
+        std::vector<arma::uword>(permutation.begin(), permutation.end()));
+  } catch (const std::runtime_error &) {
+    // The header matched but the factors do not: treat the file as corrupt.
+    return nullptr;
+  }
+}
+
+} // namespace ocira::core
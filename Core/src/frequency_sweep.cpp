@@ -0,0 +1,256 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        frequency_sweep.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Parallel AC analysis of a circuit over a list of frequencies.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Split the work with ThreadPool::runRanges.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "frequency_sweep.hpp"
+#include "circuit.hpp"
+#include "circuit_calculator.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+namespace ocira::core {
+
+std::vector<float> FrequencySweep::linearPoints(float start, float stop, uint32_t numberOfPoints) {
+  if (start < 0.0f || stop < 0.0f || numberOfPoints == 0) {
+    throw std::runtime_error("Invalid linear frequency range!");
+  }
+
+  std::vector<float> frequencies(numberOfPoints, start);
+  const double step = numberOfPoints > 1 ? (double(stop) - start) / (numberOfPoints - 1) : 0.0;
+  for (uint32_t k = 1; k < numberOfPoints; k++) {
+    frequencies[k] = static_cast<float>(start + step * k);
+  }
+  return frequencies;
+}
+
+std::vector<float> FrequencySweep::logarithmicPoints(float start, float stop,
+                                                     uint32_t numberOfPoints) {
+  if (start <= 0.0f || stop <= 0.0f || numberOfPoints == 0) {
+    throw std::runtime_error("Invalid logarithmic frequency range!");
+  }
+
+  std::vector<float> frequencies(numberOfPoints, start);
+  const double logStart = std::log(double(start));
+  const double step =
+      numberOfPoints > 1 ? (std::log(double(stop)) - logStart) / (numberOfPoints - 1) : 0.0;
+  for (uint32_t k = 1; k < numberOfPoints; k++) {
+    frequencies[k] = static_cast<float>(std::exp(logStart + step * k));
+  }
+  return frequencies;
+}
+
+FrequencySweepResult FrequencySweep::run(const std::shared_ptr<const Circuit> &circuit,
+                                         const std::vector<float> &frequencies, ThreadPool &pool) {
+  if (frequencies.empty()) {
+    throw std::runtime_error("Frequency list is empty!");
+  }
+  _checkCircuit(*circuit);
+
+  FrequencySweepResult result;
+  result.frequencies = frequencies;
+  result.solutions = _solveBatch(CircuitSnapshot(circuit), frequencies, pool);
+  return result;
+}
+
+FrequencySweepResult FrequencySweep::run(const std::shared_ptr<const Circuit> &circuit,
+                                         const std::vector<float> &frequencies,
+                                         uint32_t numberOfThreads) {
+  ThreadPool pool(numberOfThreads);
+  return run(circuit, frequencies, pool);
+}
+
+AdaptiveSweepResult FrequencySweep::runAdaptive(const std::shared_ptr<const Circuit> &circuit,
+                                                float start, float stop,
+                                                const AdaptiveSweepOptions &options,
+                                                ThreadPool &pool) {
+  if (options.initialPoints < 2 || options.maxPoints < options.initialPoints ||
+      !(options.tolerance > 0.0) || !(stop > start)) {
+    throw std::runtime_error("Invalid adaptive sweep settings!");
+  }
+  _checkCircuit(*circuit);
+
+  const CircuitSnapshot base(circuit);
+  std::vector<float> frequencies =
+      options.logarithmic ? logarithmicPoints(start, stop, options.initialPoints)
+                          : linearPoints(start, stop, options.initialPoints);
+
+  // Samples sorted by frequency, and the scale that the tolerance is relative to.
+  std::map<float, arma::cx_vec> samples;
+  double scale = 0.0;
+  auto addSamples = [&](const std::vector<float> &points, const arma::cx_mat &solutions) {
+    for (size_t k = 0; k < points.size(); k++) {
+      arma::cx_vec solution(solutions.colptr(k), solutions.n_rows);
+      for (arma::uword row = 0; row < solution.n_elem; row++) {
+        scale = std::max(scale, std::abs(solution(row)));
+      }
+      samples.emplace(points[k], std::move(solution));
+    }
+  };
+  addSamples(frequencies, _solveBatch(base, frequencies, pool));
+
+  // Position of a frequency on the sweep scale. Midpoints are taken on this scale, so that the
+  // midpoint solution can be compared with the plain average of the end points.
+  auto position = [&](float frequency) {
+    return options.logarithmic ? std::log(double(frequency)) : double(frequency);
+  };
+  auto midpoint = [&](float left, float right) {
+    return static_cast<float>(options.logarithmic ? std::sqrt(double(left) * right)
+                                                  : 0.5 * (double(left) + right));
+  };
+
+  std::vector<std::pair<float, float>> intervals;
+  for (size_t k = 0; k + 1 < frequencies.size(); k++) {
+    intervals.emplace_back(frequencies[k], frequencies[k + 1]);
+  }
+
+  bool converged = true;
+  while (!intervals.empty()) {
+    // Intervals that float precision cannot split any further are accepted as they are.
+    std::vector<std::pair<float, float>> splittable;
+    std::vector<float> midpoints;
+    for (const auto &[left, right] : intervals) {
+      const float middle = midpoint(left, right);
+      if (middle > left && middle < right) {
+        splittable.emplace_back(left, right);
+        midpoints.push_back(middle);
+      }
+    }
+
+    const size_t budget = options.maxPoints - samples.size();
+    if (midpoints.size() > budget) {
+      splittable.resize(budget);
+      midpoints.resize(budget);
+      converged = false;
+    }
+    if (midpoints.empty()) {
+      break;
+    }
+
+    addSamples(midpoints, _solveBatch(base, midpoints, pool));
+
+    // Split the intervals whose midpoint is not predicted by linear interpolation.
+    const double limit = options.tolerance * scale;
+    std::vector<std::pair<float, float>> refined;
+    for (size_t k = 0; k < splittable.size(); k++) {
+      const auto &[left, right] = splittable[k];
+      const arma::cx_vec &leftSolution = samples.at(left);
+      const arma::cx_vec &rightSolution = samples.at(right);
+      const arma::cx_vec &middleSolution = samples.at(midpoints[k]);
+      double deviation = 0.0;
+      for (arma::uword row = 0; row < middleSolution.n_elem; row++) {
+        const std::complex<double> predicted = 0.5 * (leftSolution(row) + rightSolution(row));
+        deviation = std::max(deviation, std::abs(middleSolution(row) - predicted));
+      }
+      if (deviation > limit) {
+        refined.emplace_back(left, midpoints[k]);
+        refined.emplace_back(midpoints[k], right);
+      }
+    }
+    intervals = std::move(refined);
+  }
+
+  AdaptiveSweepResult result;
+  result.converged = converged;
+  result.numberOfSolves = samples.size();
+  result.sweep.frequencies.reserve(samples.size());
+  result.sweep.solutions.set_size(samples.begin()->second.n_elem, samples.size());
+
+  double finestStep = position(stop) - position(start);
+  float previous = samples.begin()->first;
+  size_t column = 0;
+  for (const auto &[frequency, solution] : samples) {
+    if (column > 0) {
+      finestStep = std::min(finestStep, position(frequency) - position(previous));
+    }
+    result.sweep.frequencies.push_back(frequency);
+    std::copy(solution.memptr(), solution.memptr() + solution.n_elem,
+              result.sweep.solutions.colptr(column++));
+    previous = frequency;
+  }
+
+  // Adaptive intervals are the coarse step halved a whole number of times, so the ratio is
+  // nearly an integer. The small offset absorbs rounding of the float frequencies.
+  const double intervalsNeeded = (position(stop) - position(start)) / finestStep;
+  result.numberOfDenseSolves = static_cast<size_t>(std::ceil(intervalsNeeded - 1e-3)) + 1;
+  return result;
+}
+
+// PRIVATE METHODS
+
+void FrequencySweep::_checkCircuit(const Circuit &circuit) {
+  if (circuit.getSimulationMode() != SimulationMode::AC) {
+    throw std::runtime_error("Frequency sweeps need an AC circuit!");
+  }
+
+  ValidationOptions options;
+  options.failFast = true;
+  if (!CircuitValidator::isValidCircuit(circuit, options).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+}
+
+arma::cx_mat FrequencySweep::_solveBatch(const CircuitSnapshot &base,
+                                         const std::vector<float> &frequencies,
+                                         ThreadPool &pool) {
+  // The system size does not depend on the frequency, so the first point sizes the result.
+  arma::cx_vec first = _solvePoint(base, frequencies[0]);
+  arma::cx_mat solutions(first.n_elem, frequencies.size());
+  std::copy(first.memptr(), first.memptr() + first.n_elem, solutions.colptr(0));
+
+  // Hand each thread one contiguous range of the other points, so every task writes its own
+  // columns.
+  pool.runRanges(frequencies.size() - 1, [&](size_t, size_t begin, size_t end) {
+    for (size_t k = begin + 1; k <= end; k++) {
+      arma::cx_vec solution = _solvePoint(base, frequencies[k]);
+      std::copy(solution.memptr(), solution.memptr() + solution.n_elem, solutions.colptr(k));
+    }
+  });
+
+  return solutions;
+}
+
+arma::cx_vec FrequencySweep::_solvePoint(const CircuitSnapshot &base, float frequency) {
+  CircuitTransformer transformer(base.withFrequency(frequency));
+  return *CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                           transformer.getCurrentVector());
+}
+
+} // namespace ocira::core
@@ -0,0 +1,556 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        incremental_validator.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Circuit validation that is kept up to date while the circuit is edited.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Allow diodes in DC circuits only.
+// - 2026-10-19 Martin Vidjeskog: Reject circuits with subcircuit instances.
+// - 2026-10-19 Martin Vidjeskog: Split only the affected set when edits remove connections.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "incremental_validator.hpp"
+#include "circuit.hpp"
+#include "connection_manager.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace ocira::core::components;
+using namespace ocira::core::managers;
+
+namespace ocira::core {
+
+static bool isIncompatible(ComponentType type, SimulationMode mode) {
+  switch (type) {
+  case ComponentType::UNDEFINED:
+    return true;
+  case ComponentType::AC_CURRENT_SOURCE:
+  case ComponentType::AC_VOLTAGE_SOURCE:
+  case ComponentType::CAPACITOR:
+  case ComponentType::INDUCTOR:
+    return mode == SimulationMode::DC;
+  case ComponentType::DC_CURRENT_SOURCE:
+  case ComponentType::DC_VOLTAGE_SOURCE:
+    return mode == SimulationMode::AC;
+  case ComponentType::DIODE:
+    return mode != SimulationMode::DC;
+  default:
+    return false;
+  }
+}
+
+IncrementalValidator::IncrementalValidator(SimulationMode mode)
+    : m_simulationMode(mode), m_numberOfGrounds(0), m_numberOfDeadSets(0),
+      m_resultOutdated(true), m_result{true, {}} {}
+
+IncrementalValidator::IncrementalValidator(const Circuit &circuit)
+    : IncrementalValidator(circuit.getSimulationMode()) {
+  if (!circuit.getSubcircuitInstances().empty()) {
+    throw std::runtime_error("Incremental validation does not support subcircuit instances!");
+  }
+
+  this->m_buses.reserve(circuit.getBuses().size());
+  this->m_components.reserve(circuit.getComponents().size());
+
+  for (const std::shared_ptr<Bus> &bus : circuit.getBuses()) {
+    this->addBus(bus);
+  }
+
+  for (const std::shared_ptr<Component> &component : circuit.getComponents()) {
+    this->addComponent(component);
+  }
+}
+
+void IncrementalValidator::addBus(const std::shared_ptr<Bus> &bus) {
+  const BusId id = bus->getId();
+
+  if (this->m_buses.count(id) > 0) {
+    this->m_duplicateBuses.insert(id);
+  }
+  this->m_buses.emplace(id, bus);
+
+  if (!bus->isConnected()) {
+    this->m_unconnectedBuses.insert(id);
+  }
+
+  if (this->m_busIndices.emplace(id, this->m_busSets.getSize()).second) {
+    this->m_busSets.add();
+  }
+
+  // Components that are already tracked may now join this bus to others.
+  for (const std::shared_ptr<Component> &component : bus->getComponents()) {
+    if (this->_isTracked(*component)) {
+      this->_uniteConnections(*component);
+    }
+  }
+
+  this->m_resultOutdated = true;
+}
+
+bool IncrementalValidator::removeBus(const std::shared_ptr<Bus> &bus) {
+  const BusId id = bus->getId();
+  auto range = this->m_buses.equal_range(id);
+  auto it = range.first;
+  while (it != range.second && it->second != bus) {
+    ++it;
+  }
+
+  if (it == range.second) {
+    return false;
+  }
+  this->m_buses.erase(it);
+
+  _updateFlag(this->m_unconnectedBuses, id, !bus->isConnected(), false);
+  const bool hasTwin = this->m_buses.count(id) > 0;
+  if (hasTwin) {
+    _updateFlag(this->m_duplicateBuses, id, true, false);
+  } else {
+    this->m_busIndices.erase(id);
+  }
+
+  // The buses that this bus joined may now fall apart. A bus with the same identifier still
+  // holds the connections of its twin.
+  std::vector<BusId> joined;
+  if (hasTwin) {
+    joined.push_back(id);
+  }
+  this->_collectNeighbors(*bus, joined);
+
+  if (joined.empty()) {
+    // The set of the bus no longer has any tracked bus in it.
+    this->m_numberOfDeadSets++;
+    this->_compactConnectivity();
+  } else {
+    this->_splitConnectivity(joined);
+  }
+
+  this->m_resultOutdated = true;
+  return true;
+}
+
+void IncrementalValidator::addComponent(const std::shared_ptr<Component> &component) {
+  const ComponentId id = component->getId();
+  const ComponentType type = component->getComponentType();
+
+  if (this->m_components.count(id) > 0) {
+    this->m_duplicateComponents.insert(id);
+  }
+  this->m_components.emplace(id, component);
+
+  if (!component->isConnected()) {
+    this->m_unconnectedComponents.insert(id);
+  }
+
+  if (type == ComponentType::GROUND) {
+    this->m_numberOfGrounds++;
+  }
+
+  if (isIncompatible(type, SimulationMode::DC)) {
+    this->m_incompatibleForDC.insert(id);
+  }
+
+  if (isIncompatible(type, SimulationMode::AC)) {
+    this->m_incompatibleForAC.insert(id);
+  }
+
+  if (isIncompatible(type, SimulationMode::TRANSIENT)) {
+    this->m_incompatibleForTransient.insert(id);
+  }
+
+  this->_uniteConnections(*component);
+
+  this->m_resultOutdated = true;
+}
+
+bool IncrementalValidator::removeComponent(const std::shared_ptr<Component> &component) {
+  const ComponentId id = component->getId();
+  const ComponentType type = component->getComponentType();
+  auto range = this->m_components.equal_range(id);
+  auto it = range.first;
+  while (it != range.second && it->second != component) {
+    ++it;
+  }
+
+  if (it == range.second) {
+    return false;
+  }
+  this->m_components.erase(it);
+
+  _updateFlag(this->m_unconnectedComponents, id, !component->isConnected(), false);
+  _updateFlag(this->m_duplicateComponents, id, this->m_components.count(id) > 0, false);
+  _updateFlag(this->m_incompatibleForDC, id, isIncompatible(type, SimulationMode::DC), false);
+  _updateFlag(this->m_incompatibleForAC, id, isIncompatible(type, SimulationMode::AC), false);
+  _updateFlag(this->m_incompatibleForTransient, id,
+              isIncompatible(type, SimulationMode::TRANSIENT), false);
+
+  if (type == ComponentType::GROUND) {
+    this->m_numberOfGrounds--;
+  }
+
+  std::vector<BusId> joined;
+  for (const Connection &connection : component->getConnections()) {
+    std::shared_ptr<Bus> bus = connection.bus.lock();
+    if (bus && this->_getIndex(*bus) != NeighborScratch::NO_INDEX) {
+      joined.push_back(bus->getId());
+    }
+  }
+  this->_splitConnectivity(joined);
+
+  this->m_resultOutdated = true;
+  return true;
+}
+
+void IncrementalValidator::connect(const std::shared_ptr<Bus> &bus,
+                                   const std::shared_ptr<Component> &component,
+                                   TerminalRole role) {
+  const bool busWasConnected = bus->isConnected();
+  const bool componentWasConnected = component->isConnected();
+  ConnectionManager::connectBusAndComponent(bus, component, role);
+
+  if (this->_isTracked(*bus)) {
+    _updateFlag(this->m_unconnectedBuses, bus->getId(), !busWasConnected, !bus->isConnected());
+  }
+
+  if (this->_isTracked(*component)) {
+    _updateFlag(this->m_unconnectedComponents, component->getId(), !componentWasConnected,
+                !component->isConnected());
+    this->_uniteConnections(*component);
+  }
+
+  this->m_resultOutdated = true;
+}
+
+void IncrementalValidator::disconnect(const std::shared_ptr<Bus> &bus,
+                                      const std::shared_ptr<Component> &component) {
+  const bool busWasConnected = bus->isConnected();
+  const bool componentWasConnected = component->isConnected();
+  ConnectionManager::disconnectBusAndComponent(bus, component);
+
+  if (this->_isTracked(*bus)) {
+    _updateFlag(this->m_unconnectedBuses, bus->getId(), !busWasConnected, !bus->isConnected());
+  }
+
+  if (this->_isTracked(*component)) {
+    _updateFlag(this->m_unconnectedComponents, component->getId(), !componentWasConnected,
+                !component->isConnected());
+
+    // The bus may have been the only link between the other buses of the component.
+    if (this->_isTracked(*bus)) {
+      std::vector<BusId> joined{bus->getId()};
+      for (const Connection &connection : component->getConnections()) {
+        std::shared_ptr<Bus> other = connection.bus.lock();
+        if (other && this->_getIndex(*other) != NeighborScratch::NO_INDEX) {
+          joined.push_back(other->getId());
+        }
+      }
+      this->_splitConnectivity(joined);
+    }
+  }
+
+  this->m_resultOutdated = true;
+}
+
+void IncrementalValidator::setSimulationMode(SimulationMode mode) {
+  if (this->m_simulationMode != mode) {
+    this->m_simulationMode = mode;
+    this->m_resultOutdated = true;
+  }
+}
+
+const ValidationResult &IncrementalValidator::getResult() {
+  if (!this->m_resultOutdated) {
+    return this->m_result;
+  }
+
+  // Build the error list from the tracked state, in the order of CircuitValidator.
+  ValidationResult &result = this->m_result;
+  result.errors.clear();
+
+  for (BusId id : this->m_unconnectedBuses) {
+    result.errors.push_back({ValidationErrorCode::UNCONNECTED_BUS, ElementKind::BUS, id});
+  }
+
+  for (ComponentId id : this->m_unconnectedComponents) {
+    result.errors.push_back(
+        {ValidationErrorCode::UNCONNECTED_COMPONENT, ElementKind::COMPONENT, id});
+  }
+
+  if (this->m_numberOfGrounds == 0) {
+    result.errors.push_back({ValidationErrorCode::GROUND_COMPONENT_MISSING, ElementKind::NONE, 0});
+  }
+
+  if (this->m_simulationMode == SimulationMode::DC) {
+    for (ComponentId id : this->m_incompatibleForDC) {
+      result.errors.push_back({ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_DC_SIMULATION,
+                               ElementKind::COMPONENT, id});
+    }
+  } else if (this->m_simulationMode == SimulationMode::AC) {
+    for (ComponentId id : this->m_incompatibleForAC) {
+      result.errors.push_back({ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_AC_SIMULATION,
+                               ElementKind::COMPONENT, id});
+    }
+  } else if (this->m_simulationMode == SimulationMode::TRANSIENT) {
+    for (ComponentId id : this->m_incompatibleForTransient) {
+      result.errors.push_back(
+          {ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_TRANSIENT_SIMULATION,
+           ElementKind::COMPONENT, id});
+    }
+  }
+
+  for (BusId id : this->m_duplicateBuses) {
+    result.errors.push_back({ValidationErrorCode::DUPLICATE_IDENTIFIER, ElementKind::BUS, id});
+  }
+
+  for (ComponentId id : this->m_duplicateComponents) {
+    result.errors.push_back(
+        {ValidationErrorCode::DUPLICATE_IDENTIFIER, ElementKind::COMPONENT, id});
+  }
+
+  const uint32_t numberOfSets = this->m_busSets.getNumberOfSets() - this->m_numberOfDeadSets;
+  if (!this->m_buses.empty() && (numberOfSets != 1 || !this->m_duplicateBuses.empty())) {
+    result.errors.push_back(
+        {ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED, ElementKind::NONE, 0});
+  }
+
+  result.isValid = result.errors.empty();
+  this->m_resultOutdated = false;
+  return result;
+}
+
+// PRIVATE METHODS
+
+bool IncrementalValidator::_isTracked(const Bus &bus) const {
+  auto range = this->m_buses.equal_range(bus.getId());
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second.get() == &bus) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool IncrementalValidator::_isTracked(const Component &component) const {
+  auto range = this->m_components.equal_range(component.getId());
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second.get() == &component) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t IncrementalValidator::_getIndex(const Bus &bus) const {
+  if (!this->_isTracked(bus)) {
+    return NeighborScratch::NO_INDEX;
+  }
+  return this->m_busIndices.at(bus.getId());
+}
+
+void IncrementalValidator::_uniteConnections(const Component &component) {
+  uint32_t first = NeighborScratch::NO_INDEX;
+
+  for (const Connection &connection : component.getConnections()) {
+    std::shared_ptr<Bus> bus = connection.bus.lock();
+    if (!bus) {
+      continue;
+    }
+
+    const uint32_t index = this->_getIndex(*bus);
+    if (index == NeighborScratch::NO_INDEX) {
+      continue;
+    }
+
+    if (first == NeighborScratch::NO_INDEX) {
+      first = index;
+    } else {
+      this->m_busSets.unite(first, index);
+    }
+  }
+}
+
+void IncrementalValidator::_collectNeighbors(const Bus &bus, std::vector<BusId> &busIds) {
+  bus.forEachNeighborBus(
+      this->m_neighborScratch,
+      [this](const Component &component) { return this->_isTracked(component); },
+      [this](const Bus &other) { return this->_getIndex(other); },
+      [&busIds](const std::shared_ptr<Bus> &other, uint32_t) { busIds.push_back(other->getId()); });
+}
+
+void IncrementalValidator::_splitConnectivity(const std::vector<BusId> &busIds) {
+  // One search starts from every distinct bus. The searches take one step each in turn, and
+  // two searches that reach the same bus are in the same part. Once at most one part is still
+  // being explored, every finished part has been found completely.
+  struct Search {
+    std::vector<BusId> stack;
+    std::vector<BusId> visited;
+  };
+
+  std::vector<Search> searches;
+  std::vector<uint32_t> parts;
+  std::unordered_map<uint32_t, uint32_t> owners;
+  for (BusId id : busIds) {
+    const uint32_t index = this->m_busIndices.at(id);
+    if (owners.emplace(index, static_cast<uint32_t>(searches.size())).second) {
+      parts.push_back(static_cast<uint32_t>(searches.size()));
+      searches.push_back({{id}, {id}});
+    }
+  }
+
+  if (searches.size() < 2) {
+    return;
+  }
+
+  auto findPart = [&parts](uint32_t search) {
+    while (parts[search] != search) {
+      parts[search] = parts[parts[search]];
+      search = parts[search];
+    }
+    return search;
+  };
+
+  std::vector<BusId> neighbors;
+  while (true) {
+    uint32_t exploring = NeighborScratch::NO_INDEX;
+    bool severalExploring = false;
+    for (uint32_t search = 0; search < searches.size(); search++) {
+      if (searches[search].stack.empty()) {
+        continue;
+      }
+      const uint32_t part = findPart(search);
+      if (exploring == NeighborScratch::NO_INDEX) {
+        exploring = part;
+      } else if (exploring != part) {
+        severalExploring = true;
+      }
+    }
+
+    if (!severalExploring) {
+      break;
+    }
+
+    for (uint32_t search = 0; search < searches.size(); search++) {
+      std::vector<BusId> &stack = searches[search].stack;
+      if (stack.empty()) {
+        continue;
+      }
+      const BusId id = stack.back();
+      stack.pop_back();
+
+      neighbors.clear();
+      auto range = this->m_buses.equal_range(id);
+      for (auto it = range.first; it != range.second; ++it) {
+        this->_collectNeighbors(*it->second, neighbors);
+      }
+
+      for (BusId neighbor : neighbors) {
+        auto owner = owners.emplace(this->m_busIndices.at(neighbor), search);
+        if (owner.second) {
+          stack.push_back(neighbor);
+          searches[search].visited.push_back(neighbor);
+        } else {
+          parts[findPart(owner.first->second)] = findPart(search);
+        }
+      }
+    }
+  }
+
+  // The part that is still being explored keeps its entries. If every part is finished, the
+  // largest one keeps them.
+  uint32_t remainder = NeighborScratch::NO_INDEX;
+  std::vector<size_t> partSizes(searches.size(), 0);
+  for (uint32_t search = 0; search < searches.size(); search++) {
+    const uint32_t part = findPart(search);
+    partSizes[part] += searches[search].visited.size();
+    if (!searches[search].stack.empty()) {
+      remainder = part;
+    }
+  }
+  if (remainder == NeighborScratch::NO_INDEX) {
+    remainder = static_cast<uint32_t>(
+        std::max_element(partSizes.begin(), partSizes.end()) - partSizes.begin());
+  }
+
+  std::vector<uint32_t> newIndices(searches.size(), NeighborScratch::NO_INDEX);
+  for (uint32_t search = 0; search < searches.size(); search++) {
+    const uint32_t part = findPart(search);
+    if (part == remainder) {
+      continue;
+    }
+
+    for (BusId id : searches[search].visited) {
+      const uint32_t index = this->m_busSets.add();
+      this->m_busIndices[id] = index;
+      if (newIndices[part] == NeighborScratch::NO_INDEX) {
+        newIndices[part] = index;
+      } else {
+        this->m_busSets.unite(newIndices[part], index);
+      }
+    }
+  }
+
+  this->_compactConnectivity();
+}
+
+void IncrementalValidator::_compactConnectivity() {
+  // Removed buses and the old entries of split parts stay behind in the union-find structure.
+  if (this->m_busSets.getSize() > 2 * this->m_busIndices.size() + 64) {
+    this->_rebuildConnectivity();
+  }
+}
+
+void IncrementalValidator::_rebuildConnectivity() {
+  this->m_busIndices.clear();
+  for (const auto &entry : this->m_buses) {
+    this->m_busIndices.emplace(entry.first, static_cast<uint32_t>(this->m_busIndices.size()));
+  }
+
+  this->m_busSets = DisjointSet(static_cast<uint32_t>(this->m_busIndices.size()));
+  this->m_numberOfDeadSets = 0;
+  for (const auto &entry : this->m_components) {
+    this->_uniteConnections(*entry.second);
+  }
+}
+
+void IncrementalValidator::_updateFlag(std::multiset<uint32_t> &set, uint32_t id,
+                                       bool wasFlagged, bool isFlagged) {
+  if (wasFlagged == isFlagged) {
+    return;
+  }
+
+  if (isFlagged) {
+    set.insert(id);
+  } else {
+    auto it = set.find(id);
+    if (it != set.end()) {
+      set.erase(it);
+    }
+  }
+}
+
+} // namespace ocira::core
@@ -0,0 +1,409 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        monte_carlo.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Monte Carlo tolerance analysis with online statistics.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Truncate Gaussian deviations by rejection instead of clamping.
+// - 2026-10-19 Martin Vidjeskog: Read voltage source rows from CircuitTransformer.
+// - 2026-10-19 Martin Vidjeskog: Split the work with ThreadPool::runRanges.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "monte_carlo.hpp"
+#include "ac_current_source.hpp"
+#include "ac_voltage_source.hpp"
+#include "capacitor.hpp"
+#include "circuit.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include "dc_current_source.hpp"
+#include "dc_voltage_source.hpp"
+#include "inductor.hpp"
+#include "resistor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+namespace {
+
+constexpr double TWO_PI = 6.283185307179586;
+
+/// @brief SplitMix64 finalizer, a bijective mix of all bits of a 64-bit value.
+uint64_t mix(uint64_t x) noexcept {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/// @brief Returns a uniform number in [0, 1) for a seed, a sample and a stream. The number is a
+/// pure function of its arguments, so no generator state is shared between threads.
+double getUniform(uint64_t seed, uint64_t sample, uint64_t stream) noexcept {
+  return static_cast<double>(mix(mix(mix(seed) ^ sample) ^ stream) >> 11) * 0x1.0p-53;
+}
+
+/// @brief Entries that a toleranced component contributes at its nominal value.
+/// A deviation multiplies every entry by scale - 1 and adds it, where scale is 1 + deviation, or
+/// its inverse for resistors and inductors, whose admittance is inversely proportional to the
+/// value.
+struct ToleranceStamp {
+  std::vector<std::pair<std::pair<arma::uword, arma::uword>, std::complex<double>>> admittances;
+  std::vector<std::pair<arma::uword, std::complex<double>>> currents;
+  bool isInverse;
+};
+
+/// @brief Adds the four entries of a two-terminal admittance to a stamp.
+void addAdmittance(ToleranceStamp &stamp, BusNumber i, BusNumber j,
+                   std::complex<double> admittance) {
+  if (i != 0) {
+    stamp.admittances.push_back({{i - 1, i - 1}, admittance});
+  }
+  if (j != 0) {
+    stamp.admittances.push_back({{j - 1, j - 1}, admittance});
+  }
+  if (i != 0 && j != 0) {
+    stamp.admittances.push_back({{i - 1, j - 1}, -admittance});
+    stamp.admittances.push_back({{j - 1, i - 1}, -admittance});
+  }
+}
+
+} // namespace
+
+RunningStatistics::RunningStatistics(double lower, double upper, uint32_t numberOfBins)
+    : m_count(0), m_mean(0.0), m_sumOfSquares(0.0),
+      m_minimum(std::numeric_limits<double>::infinity()),
+      m_maximum(-std::numeric_limits<double>::infinity()), m_lower(lower), m_upper(upper),
+      m_histogram(numberOfBins, 0), m_underflow(0), m_overflow(0) {
+  if (!(upper > lower) || numberOfBins == 0) {
+    throw std::runtime_error("Invalid histogram range!");
+  }
+}
+
+void RunningStatistics::add(double value) noexcept {
+  this->m_count++;
+  const double delta = value - this->m_mean;
+  this->m_mean += delta / static_cast<double>(this->m_count);
+  this->m_sumOfSquares += delta * (value - this->m_mean);
+  this->m_minimum = std::min(this->m_minimum, value);
+  this->m_maximum = std::max(this->m_maximum, value);
+
+  if (value < this->m_lower) {
+    this->m_underflow++;
+  } else if (value <= this->m_upper) {
+    const double position = (value - this->m_lower) / (this->m_upper - this->m_lower);
+    const size_t bin = std::min(static_cast<size_t>(position * this->m_histogram.size()),
+                                this->m_histogram.size() - 1);
+    this->m_histogram[bin]++;
+  } else {
+    this->m_overflow++;
+  }
+}
+
+void RunningStatistics::merge(const RunningStatistics &other) {
+  if (other.m_lower != this->m_lower || other.m_upper != this->m_upper ||
+      other.m_histogram.size() != this->m_histogram.size()) {
+    throw std::runtime_error("Histograms do not match!");
+  }
+  if (other.m_count == 0) {
+    return;
+  }
+
+  // Chan's formula for combining the moments of two series.
+  const double count = static_cast<double>(this->m_count + other.m_count);
+  const double delta = other.m_mean - this->m_mean;
+  this->m_mean += delta * static_cast<double>(other.m_count) / count;
+  this->m_sumOfSquares += other.m_sumOfSquares + delta * delta *
+                                                     static_cast<double>(this->m_count) *
+                                                     static_cast<double>(other.m_count) / count;
+  this->m_count += other.m_count;
+  this->m_minimum = std::min(this->m_minimum, other.m_minimum);
+  this->m_maximum = std::max(this->m_maximum, other.m_maximum);
+  for (size_t k = 0; k < this->m_histogram.size(); k++) {
+    this->m_histogram[k] += other.m_histogram[k];
+  }
+  this->m_underflow += other.m_underflow;
+  this->m_overflow += other.m_overflow;
+}
+
+uint64_t RunningStatistics::getCount() const noexcept { return this->m_count; }
+
+double RunningStatistics::getMean() const noexcept { return this->m_mean; }
+
+double RunningStatistics::getVariance() const noexcept {
+  return this->m_count > 1 ? this->m_sumOfSquares / static_cast<double>(this->m_count - 1) : 0.0;
+}
+
+double RunningStatistics::getStandardDeviation() const noexcept {
+  return std::sqrt(this->getVariance());
+}
+
+double RunningStatistics::getMinimum() const noexcept { return this->m_minimum; }
+
+double RunningStatistics::getMaximum() const noexcept { return this->m_maximum; }
+
+double RunningStatistics::getHistogramLower() const noexcept { return this->m_lower; }
+
+double RunningStatistics::getHistogramUpper() const noexcept { return this->m_upper; }
+
+const std::vector<uint64_t> &RunningStatistics::getHistogram() const noexcept {
+  return this->m_histogram;
+}
+
+uint64_t RunningStatistics::getUnderflow() const noexcept { return this->m_underflow; }
+
+uint64_t RunningStatistics::getOverflow() const noexcept { return this->m_overflow; }
+
+MonteCarloResult MonteCarlo::run(const std::shared_ptr<const Circuit> &circuit,
+                                 const std::vector<ComponentTolerance> &tolerances,
+                                 const std::vector<MonteCarloOutput> &outputs,
+                                 const MonteCarloOptions &options, ThreadPool &pool) {
+  if (outputs.empty() || options.numberOfSamples == 0 || options.histogramBins == 0 ||
+      !(options.histogramSpan > 0.0)) {
+    throw std::runtime_error("Invalid Monte Carlo settings!");
+  }
+  if (circuit->getSimulationMode() == SimulationMode::TRANSIENT) {
+    throw std::runtime_error("Monte Carlo analysis needs a DC or AC circuit!");
+  }
+
+  ValidationOptions validationOptions;
+  validationOptions.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, validationOptions).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+
+  // 1. Transform the nominal circuit once. Its numbering and entries are shared by all samples.
+  const CircuitTransformer transformer{CircuitSnapshot(circuit)};
+  const arma::cx_mat &nominalY = *transformer.getAdmittanceMatrix();
+  const arma::cx_vec &nominalJ = *transformer.getCurrentVector();
+  const auto &busIdMap = transformer.getBusIdMap();
+
+  // 2. Collect the entries of every toleranced component.
+  std::unordered_map<ComponentId, size_t> toleranceIndices;
+  for (size_t k = 0; k < tolerances.size(); k++) {
+    if (!(tolerances[k].tolerance >= 0.0 && tolerances[k].tolerance < 1.0)) {
+      throw std::runtime_error("Tolerance must be in [0, 1)!");
+    }
+    if (!toleranceIndices.emplace(tolerances[k].id, k).second) {
+      throw std::runtime_error("Component has more than one tolerance!");
+    }
+  }
+
+  const float frequency = circuit->getFrequency();
+
+  std::vector<ToleranceStamp> stamps(tolerances.size());
+  std::vector<bool> isStamped(tolerances.size(), false);
+  for (const auto &component : circuit->getComponents()) {
+    const ComponentType type = component->getComponentType();
+    auto it = toleranceIndices.find(component->getId());
+    if (it == toleranceIndices.end()) {
+      continue;
+    }
+    if (type == ComponentType::GROUND || type == ComponentType::WIRE) {
+      throw std::runtime_error("Component has no value to vary!");
+    }
+
+    const auto &connections = component->getConnections();
+    auto b1 = connections[0].bus.lock();
+    auto b2 = connections[1].bus.lock();
+    if (!b1 || !b2) {
+      throw std::runtime_error("Unexpected error! Pointer not existing!");
+    }
+    const BusNumber i = busIdMap.at(b1->getId());
+    const BusNumber j = busIdMap.at(b2->getId());
+
+    ToleranceStamp &stamp = stamps[it->second];
+    stamp.isInverse = type == ComponentType::RESISTOR || type == ComponentType::INDUCTOR;
+    std::complex<double> current = 0.0;
+    switch (type) {
+    case ComponentType::RESISTOR:
+      addAdmittance(stamp, i, j, std::static_pointer_cast<Resistor>(component)->getConductance());
+      break;
+    case ComponentType::CAPACITOR:
+      addAdmittance(stamp, i, j,
+                    std::complex<double>(
+                        std::static_pointer_cast<Capacitor>(component)->getAdmittance(frequency)));
+      break;
+    case ComponentType::INDUCTOR:
+      addAdmittance(stamp, i, j,
+                    std::complex<double>(
+                        std::static_pointer_cast<Inductor>(component)->getAdmittance(frequency)));
+      break;
+    case ComponentType::DC_CURRENT_SOURCE:
+      current = std::static_pointer_cast<DCCurrentSource>(component)->getAmps();
+      break;
+    case ComponentType::AC_CURRENT_SOURCE:
+      current = std::complex<double>(
+          std::static_pointer_cast<ACCurrentSource>(component)->getPhasor());
+      break;
+    case ComponentType::DC_VOLTAGE_SOURCE:
+      stamp.currents.emplace_back(
+          transformer.getVoltageSourceRow(component->getId()),
+          std::static_pointer_cast<DCVoltageSource>(component)->getVolts());
+      break;
+    case ComponentType::AC_VOLTAGE_SOURCE:
+      stamp.currents.emplace_back(
+          transformer.getVoltageSourceRow(component->getId()),
+          std::complex<double>(std::static_pointer_cast<ACVoltageSource>(component)->getPhasor()));
+      break;
+    default:
+      throw std::runtime_error("Unsupported component type!");
+    }
+
+    if (current != 0.0) {
+      const BusNumber buses[2] = {i, j};
+      for (size_t k = 0; k < 2; k++) {
+        if (buses[k] != 0) {
+          stamp.currents.emplace_back(
+              buses[k] - 1, connections[k].role == TerminalRole::POSITIVE ? current : -current);
+        }
+      }
+    }
+    isStamped[it->second] = true;
+  }
+  if (std::find(isStamped.begin(), isStamped.end(), false) != isStamped.end()) {
+    throw std::runtime_error("Tolerance refers to an unknown component!");
+  }
+
+  // 3. Solve the nominal circuit, which also sizes the histograms.
+  std::vector<BusNumber> outputRows;
+  for (const MonteCarloOutput &output : outputs) {
+    auto it = busIdMap.find(output.busId);
+    if (it == busIdMap.end()) {
+      throw std::runtime_error("Output refers to an unknown bus!");
+    }
+    outputRows.push_back(it->second);
+  }
+  auto getMagnitude = [&](const arma::cx_vec &solution, size_t output) {
+    return outputRows[output] != 0 ? std::abs(solution(outputRows[output] - 1)) : 0.0;
+  };
+
+  const arma::cx_vec nominal = CircuitFactorization(nominalY).solve(nominalJ);
+  MonteCarloResult result;
+  for (size_t k = 0; k < outputs.size(); k++) {
+    const double value = getMagnitude(nominal, k);
+    const double width = value != 0.0 ? options.histogramSpan * value : options.histogramSpan;
+    result.nominalValues.push_back(value);
+    result.statistics.emplace_back(value - width, value + width, options.histogramBins);
+  }
+
+  // 4. Solve the samples. Each task takes a contiguous range of samples and collects its own
+  // statistics, which are merged in task order afterwards.
+  const uint64_t numberOfSamples = options.numberOfSamples;
+  const size_t numberOfTasks = pool.getNumberOfRanges(numberOfSamples);
+  std::vector<std::vector<RunningStatistics>> taskStatistics(numberOfTasks, result.statistics);
+  std::vector<uint64_t> passed(numberOfTasks, 0);
+  std::vector<uint64_t> failed(numberOfTasks, 0);
+
+  pool.runRanges(numberOfSamples, [&](size_t task, size_t begin, size_t end) {
+    arma::cx_mat Y;
+    arma::cx_vec J;
+
+    for (uint64_t sample = begin; sample < end; sample++) {
+      Y = nominalY;
+      J = nominalJ;
+      for (size_t k = 0; k < tolerances.size(); k++) {
+        const double deviation = getDeviation(options.seed, sample, k, tolerances[k]);
+        const double change = (stamps[k].isInverse ? 1.0 / (1.0 + deviation) : 1.0 + deviation) -
+                              1.0;
+        for (const auto &[position, value] : stamps[k].admittances) {
+          Y(position.first, position.second) += change * value;
+        }
+        for (const auto &[row, value] : stamps[k].currents) {
+          J(row) += change * value;
+        }
+      }
+
+      arma::cx_vec solution;
+      try {
+        solution = CircuitFactorization(Y).solve(J);
+      } catch (const std::runtime_error &) {
+        failed[task]++;
+        continue;
+      }
+
+      bool isPassing = true;
+      for (size_t k = 0; k < outputs.size(); k++) {
+        const double value = getMagnitude(solution, k);
+        taskStatistics[task][k].add(value);
+        isPassing = isPassing && value >= outputs[k].lowerLimit && value <= outputs[k].upperLimit;
+      }
+      passed[task] += isPassing ? 1 : 0;
+    }
+  });
+
+  result.numberOfSamples = numberOfSamples;
+  result.numberOfPassedSamples = 0;
+  result.numberOfFailedSamples = 0;
+  for (size_t task = 0; task < numberOfTasks; task++) {
+    for (size_t k = 0; k < outputs.size(); k++) {
+      result.statistics[k].merge(taskStatistics[task][k]);
+    }
+    result.numberOfPassedSamples += passed[task];
+    result.numberOfFailedSamples += failed[task];
+  }
+  result.yield = static_cast<double>(result.numberOfPassedSamples) /
+                 static_cast<double>(numberOfSamples);
+  return result;
+}
+
+double MonteCarlo::getDeviation(uint64_t seed, uint64_t sample, uint64_t index,
+                                const ComponentTolerance &tolerance) noexcept {
+  const double u1 = getUniform(seed, sample, 2 * index);
+  if (tolerance.distribution == ToleranceDistribution::UNIFORM) {
+    return tolerance.tolerance * (2.0 * u1 - 1.0);
+  }
+
+  // Box-Muller transform, which gives two independent normals per pair of uniforms. Normals
+  // beyond 3 sigma are rejected. Each is accepted with probability 0.9973, so the loop nearly
+  // always ends on the first pair. Later pairs use streams above bit 48, which never collide
+  // with the streams of other tolerances. 1 - u is in (0, 1], so the logarithm is finite.
+  for (uint64_t attempt = 0;; attempt++) {
+    const uint64_t stream = (attempt << 48) | (2 * index);
+    const double u = attempt == 0 ? u1 : getUniform(seed, sample, stream);
+    const double radius = std::sqrt(-2.0 * std::log(1.0 - u));
+    const double angle = TWO_PI * getUniform(seed, sample, stream + 1);
+    for (const double normal : {radius * std::cos(angle), radius * std::sin(angle)}) {
+      if (std::abs(normal) <= 3.0) {
+        return normal * tolerance.tolerance / 3.0;
+      }
+    }
+  }
+}
+
+} // namespace ocira::core
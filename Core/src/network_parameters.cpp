@@ -0,0 +1,179 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        network_parameters.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Z, Y and S parameters of a circuit seen as a multiport.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Split the work with ThreadPool::runRanges.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+#include "network_parameters.hpp"
+#include "bus.hpp"
+#include "circuit.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <unordered_set>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+NetworkParameterResult NetworkParameters::compute(const std::shared_ptr<const Circuit> &circuit,
+                                                  const std::vector<float> &frequencies,
+                                                  NetworkParameterType type, ThreadPool &pool) {
+  if (circuit->getSimulationMode() != SimulationMode::AC) {
+    throw std::runtime_error("Network parameters need an AC circuit!");
+  }
+  if (frequencies.empty()) {
+    throw std::runtime_error("Frequency list is empty!");
+  }
+
+  const std::vector<Port> &ports = circuit->getPorts();
+  if (ports.empty()) {
+    throw std::runtime_error("Circuit has no ports!");
+  }
+  std::unordered_set<BusId> busIds;
+  for (const auto &bus : circuit->getBuses()) {
+    busIds.insert(bus->getId());
+  }
+  for (const Port &port : ports) {
+    if (busIds.count(port.positive) == 0 || busIds.count(port.negative) == 0) {
+      throw std::runtime_error("Port bus is not part of the circuit!");
+    }
+    if (port.positive == port.negative) {
+      throw std::runtime_error("Port repeats the same bus!");
+    }
+    if (!(port.referenceImpedance > 0.0)) {
+      throw std::runtime_error("Port reference impedance must be positive!");
+    }
+  }
+
+  ValidationOptions options;
+  options.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, options).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+
+  NetworkParameterResult result;
+  result.type = type;
+  result.ports = ports;
+  result.frequencies = frequencies;
+  const size_t size = ports.size() * ports.size();
+  result.parameters.set_size(size, frequencies.size());
+
+  // Hand each thread one contiguous range of points, so every task writes its own columns.
+  const CircuitSnapshot base(circuit);
+  pool.runRanges(frequencies.size(), [&](size_t, size_t begin, size_t end) {
+    for (size_t k = begin; k < end; k++) {
+      const arma::cx_mat matrix = _computePoint(base, frequencies[k], type);
+      std::copy(matrix.memptr(), matrix.memptr() + size, result.parameters.colptr(k));
+    }
+  });
+
+  return result;
+}
+
+NetworkParameterResult NetworkParameters::compute(const std::shared_ptr<const Circuit> &circuit,
+                                                  const std::vector<float> &frequencies,
+                                                  NetworkParameterType type,
+                                                  uint32_t numberOfThreads) {
+  ThreadPool pool(numberOfThreads);
+  return compute(circuit, frequencies, type, pool);
+}
+
+// PRIVATE METHODS
+
+arma::cx_mat NetworkParameters::_computePoint(const CircuitSnapshot &base, float frequency,
+                                              NetworkParameterType type) {
+  const CircuitTransformer transformer(base.withFrequency(frequency));
+  const auto &busIdMap = transformer.getBusIdMap();
+  const std::vector<Port> &ports = base.getCircuit()->getPorts();
+  const arma::uword numberOfPorts = ports.size();
+
+  // 1. One unit current excitation per port, solved as one block.
+  std::vector<BusNumber> positives;
+  std::vector<BusNumber> negatives;
+  arma::cx_mat B(transformer.getCurrentVector()->n_elem, numberOfPorts, arma::fill::zeros);
+  for (arma::uword j = 0; j < numberOfPorts; j++) {
+    positives.push_back(busIdMap.at(ports[j].positive));
+    negatives.push_back(busIdMap.at(ports[j].negative));
+    if (positives[j] != 0) {
+      B(positives[j] - 1, j) += 1.0;
+    }
+    if (negatives[j] != 0) {
+      B(negatives[j] - 1, j) -= 1.0;
+    }
+  }
+  const arma::cx_mat X = CircuitFactorization(*transformer.getAdmittanceMatrix()).solve(B);
+
+  // 2. The port voltages of excitation j are column j of Z.
+  arma::cx_mat Z(numberOfPorts, numberOfPorts);
+  for (arma::uword j = 0; j < numberOfPorts; j++) {
+    for (arma::uword i = 0; i < numberOfPorts; i++) {
+      const std::complex<double> positive = positives[i] != 0 ? X(positives[i] - 1, j) : 0.0;
+      const std::complex<double> negative = negatives[i] != 0 ? X(negatives[i] - 1, j) : 0.0;
+      Z(i, j) = positive - negative;
+    }
+  }
+
+  // 3. Convert to the requested parameters.
+  const arma::cx_mat identity(numberOfPorts, numberOfPorts, arma::fill::eye);
+  switch (type) {
+  case NetworkParameterType::IMPEDANCE:
+    return Z;
+  case NetworkParameterType::ADMITTANCE:
+    try {
+      return CircuitFactorization(Z).solve(identity);
+    } catch (const std::runtime_error &) {
+      throw std::runtime_error("Impedance parameters are singular!");
+    }
+  case NetworkParameterType::SCATTERING: {
+    // (Zn + I)^-1 and Zn - I commute, so S is also (Zn + I)^-1 * (Zn - I).
+    arma::cx_mat sum(numberOfPorts, numberOfPorts);
+    arma::cx_mat difference(numberOfPorts, numberOfPorts);
+    for (arma::uword j = 0; j < numberOfPorts; j++) {
+      for (arma::uword i = 0; i < numberOfPorts; i++) {
+        const std::complex<double> normalized =
+            Z(i, j) / std::sqrt(ports[i].referenceImpedance * ports[j].referenceImpedance);
+        sum(i, j) = normalized + identity(i, j);
+        difference(i, j) = normalized - identity(i, j);
+      }
+    }
+    return CircuitFactorization(sum).solve(difference);
+  }
+  default:
+    throw std::runtime_error("Unsupported network parameter type!");
+  }
+}
+
+} // namespace ocira::core
@@ -0,0 +1,246 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        nonlinear_solver.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Newton-Raphson DC solver for circuits with diodes.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "nonlinear_solver.hpp"
+#include "circuit.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_validator.hpp"
+#include "diode.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+namespace {
+
+/// @brief A diode, its terminals and the linearization that is stamped into the system.
+/// The stamped branch current from anode to cathode is conductance * V + current.
+struct DiodeState {
+  std::shared_ptr<const Diode> diode;
+  BusNumber anode;
+  BusNumber cathode;
+  double thermalVoltage;  // n * Vt.
+  double criticalVoltage; // Voltage above which the exponential dominates.
+  bool isEvaluated;
+  double voltage; // Junction voltage of the last evaluation.
+  double conductance;
+  double current;
+};
+
+/// @brief Returns entry n - 1 of a vector, or zero for bus number 0, which is ground.
+double getEntry(const arma::vec &x, BusNumber n) { return n != 0 ? x(n - 1) : 0.0; }
+
+/// @brief Adds a conductance and a current source from anode to cathode to the system.
+void stampBranch(arma::cx_mat &Y, arma::cx_vec &J, BusNumber anode, BusNumber cathode,
+                 double conductance, double current) {
+  if (anode != 0) {
+    Y(anode - 1, anode - 1) += conductance;
+    J(anode - 1) -= current;
+  }
+  if (cathode != 0) {
+    Y(cathode - 1, cathode - 1) += conductance;
+    J(cathode - 1) += current;
+  }
+  if (anode != 0 && cathode != 0) {
+    Y(anode - 1, cathode - 1) -= conductance;
+    Y(cathode - 1, anode - 1) -= conductance;
+  }
+}
+
+} // namespace
+
+NewtonResult NonlinearSolver::solve(const std::shared_ptr<const Circuit> &circuit,
+                                    const NewtonOptions &options) {
+  if (options.maxIterations == 0 || !(options.relativeTolerance >= 0.0) ||
+      !(options.absoluteTolerance > 0.0) || !(options.currentTolerance > 0.0) ||
+      !(options.bypassTolerance >= 0.0)) {
+    throw std::runtime_error("Invalid Newton settings!");
+  }
+  if (circuit->getSimulationMode() != SimulationMode::DC) {
+    throw std::runtime_error("Nonlinear circuits are solved in DC mode!");
+  }
+
+  ValidationOptions validationOptions;
+  validationOptions.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, validationOptions).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+
+  // 1. Transform the linear part once. The diodes are added to copies of Y and J.
+  const CircuitTransformer transformer(CircuitSnapshot(circuit), true);
+  arma::cx_mat Y = *transformer.getAdmittanceMatrix();
+  arma::cx_vec J = *transformer.getCurrentVector();
+
+  NewtonResult result;
+  result.busIdMap = transformer.getBusIdMap();
+  std::vector<DiodeState> diodes;
+  for (const auto &component : circuit->getComponents()) {
+    if (component->getComponentType() != ComponentType::DIODE) {
+      continue;
+    }
+
+    DiodeState state{};
+    state.diode = std::static_pointer_cast<const Diode>(component);
+    bool hasAnode = false;
+    bool hasCathode = false;
+    for (const Connection &connection : component->getConnections()) {
+      auto bus = connection.bus.lock();
+      if (!bus) {
+        throw std::runtime_error("Unexpected error! Pointer not existing!");
+      }
+      if (connection.role == TerminalRole::POSITIVE) {
+        state.anode = result.busIdMap.at(bus->getId());
+        hasAnode = true;
+      } else {
+        state.cathode = result.busIdMap.at(bus->getId());
+        hasCathode = true;
+      }
+    }
+    if (!hasAnode || !hasCathode) {
+      throw std::runtime_error("Diode needs a positive and a negative terminal!");
+    }
+
+    const double saturationCurrent = state.diode->getSaturationCurrent();
+    state.thermalVoltage = state.diode->getEmissionCoefficient() * Diode::THERMAL_VOLTAGE;
+    if (!(saturationCurrent > 0.0) || !(state.thermalVoltage > 0.0)) {
+      throw std::runtime_error("Diode parameters must be positive!");
+    }
+    state.criticalVoltage = state.thermalVoltage *
+                            std::log(state.thermalVoltage / (std::sqrt(2.0) * saturationCurrent));
+    result.diodeIds.push_back(component->getId());
+    diodes.push_back(std::move(state));
+  }
+
+  auto getJunctionVoltage = [](const arma::vec &x, const DiodeState &state) {
+    return getEntry(x, state.anode) - getEntry(x, state.cathode);
+  };
+
+  // 2. Newton iteration from zero.
+  arma::vec x(Y.n_rows, arma::fill::zeros);
+  std::shared_ptr<const CircuitFactorization> factorization;
+  result.iterations = 0;
+  result.numberOfEvaluations = 0;
+  result.numberOfBypasses = 0;
+  result.numberOfFactorizations = 0;
+  result.converged = false;
+
+  while (result.iterations < options.maxIterations && !result.converged) {
+    result.iterations++;
+
+    // Linearize the diodes that moved and restamp the change of their entries.
+    bool isMatrixChanged = false;
+    for (DiodeState &state : diodes) {
+      const double voltage = getJunctionVoltage(x, state);
+      if (state.isEvaluated && std::abs(voltage - state.voltage) <= options.bypassTolerance) {
+        result.numberOfBypasses++;
+        continue;
+      }
+
+      const double conductance = state.diode->getConductance(voltage) + MINIMUM_CONDUCTANCE;
+      const double current =
+          state.diode->getCurrent(voltage) + MINIMUM_CONDUCTANCE * voltage - conductance * voltage;
+      stampBranch(Y, J, state.anode, state.cathode, conductance - state.conductance,
+                  current - state.current);
+      isMatrixChanged = isMatrixChanged || conductance != state.conductance;
+      state.isEvaluated = true;
+      state.voltage = voltage;
+      state.conductance = conductance;
+      state.current = current;
+      result.numberOfEvaluations++;
+    }
+
+    if (!factorization || isMatrixChanged) {
+      factorization = std::make_shared<const CircuitFactorization>(Y);
+      result.numberOfFactorizations++;
+    }
+    const arma::cx_vec complexSolution = factorization->solve(J);
+    arma::vec newton(complexSolution.n_elem);
+    for (arma::uword k = 0; k < newton.n_elem; k++) {
+      newton(k) = complexSolution(k).real();
+    }
+
+    // Damp the step so that no junction voltage in the exponential region grows by more than
+    // its logarithm would.
+    double damping = 1.0;
+    for (const DiodeState &state : diodes) {
+      const double oldVoltage = getJunctionVoltage(x, state);
+      const double newVoltage = getJunctionVoltage(newton, state);
+      if (newVoltage <= state.criticalVoltage ||
+          newVoltage - oldVoltage <= 2.0 * state.thermalVoltage) {
+        continue;
+      }
+      const double limited =
+          oldVoltage > 0.0
+              ? oldVoltage + state.thermalVoltage *
+                                 std::log1p((newVoltage - oldVoltage) / state.thermalVoltage)
+              : state.thermalVoltage * std::log(newVoltage / state.thermalVoltage);
+      damping = std::min(damping, (limited - oldVoltage) / (newVoltage - oldVoltage));
+    }
+
+    bool isConverged = damping == 1.0;
+    for (arma::uword k = 0; k < x.n_elem; k++) {
+      const double step = damping * (newton(k) - x(k));
+      const double scale = std::max(std::abs(x(k)), std::abs(x(k) + step));
+      isConverged = isConverged &&
+                    std::abs(step) <= options.relativeTolerance * scale + options.absoluteTolerance;
+      x(k) += step;
+    }
+
+    // The diode currents must also agree with the linearization they were solved with.
+    for (const DiodeState &state : diodes) {
+      if (!isConverged) {
+        break;
+      }
+      const double voltage = getJunctionVoltage(x, state);
+      const double current = state.diode->getCurrent(voltage) + MINIMUM_CONDUCTANCE * voltage;
+      const double linearized = state.conductance * voltage + state.current;
+      isConverged = std::abs(current - linearized) <=
+                    options.relativeTolerance * std::abs(current) + options.currentTolerance;
+    }
+    result.converged = isConverged;
+  }
+
+  result.solution = std::move(x);
+  for (const DiodeState &state : diodes) {
+    result.diodeCurrents.push_back(
+        state.diode->getCurrent(getJunctionVoltage(result.solution, state)));
+  }
+  return result;
+}
+
+} // namespace ocira::core
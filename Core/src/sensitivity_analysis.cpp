@@ -0,0 +1,217 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        sensitivity_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Adjoint sensitivities of bus voltages to component values.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Read voltage source rows from CircuitTransformer.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "sensitivity_analysis.hpp"
+#include "ac_current_source.hpp"
+#include "ac_voltage_source.hpp"
+#include "capacitor.hpp"
+#include "circuit.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include "inductor.hpp"
+#include "resistor.hpp"
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+namespace {
+
+constexpr double TWO_PI = 6.283185307179586;
+
+/// @brief How a component parameter enters the system.
+/// Two-terminal admittances y(p) between two buses contribute
+/// -(lambda_i - lambda_j) * (x_i - x_j) * dy / dp. Sources contribute lambda^T * dJ / dp, where
+/// dJ / dp has an entry of -+1 (times the unit phasor for AC sources) per terminal for current
+/// sources and on the auxiliary row for voltage sources.
+struct ParameterStamp {
+  BusNumber first;
+  BusNumber second;
+  std::complex<double> admittanceDerivative;
+  std::vector<std::pair<arma::uword, std::complex<double>>> currentDerivatives;
+};
+
+/// @brief Returns entry n - 1 of a vector, or zero for bus number 0, which is ground.
+std::complex<double> getEntry(const arma::cx_vec &x, BusNumber n) {
+  return n != 0 ? x(n - 1) : std::complex<double>(0.0);
+}
+
+} // namespace
+
+SensitivityResult SensitivityAnalysis::compute(const std::shared_ptr<const Circuit> &circuit,
+                                               const std::vector<BusId> &busIds) {
+  if (circuit->getSimulationMode() == SimulationMode::TRANSIENT) {
+    throw std::runtime_error("Sensitivity analysis needs a DC or AC circuit!");
+  }
+
+  ValidationOptions options;
+  options.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, options).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+
+  // 1. One transformation, factorization and forward solve.
+  const CircuitTransformer transformer{CircuitSnapshot(circuit)};
+  const auto &busIdMap = transformer.getBusIdMap();
+  const CircuitFactorization factorization(*transformer.getAdmittanceMatrix());
+  const arma::cx_vec x = factorization.solve(*transformer.getCurrentVector());
+
+  std::vector<BusNumber> outputs;
+  for (BusId busId : busIds) {
+    auto it = busIdMap.find(busId);
+    if (it == busIdMap.end()) {
+      throw std::runtime_error("Bus is not part of the circuit!");
+    }
+    outputs.push_back(it->second);
+  }
+
+  // 2. Derivatives of the stamps of every component.
+  const double omega = TWO_PI * circuit->getFrequency();
+
+  SensitivityResult result;
+  std::vector<ParameterStamp> stamps;
+  for (const auto &component : circuit->getComponents()) {
+    const ComponentType type = component->getComponentType();
+    if (type == ComponentType::GROUND || type == ComponentType::WIRE) {
+      continue;
+    }
+
+    const auto &connections = component->getConnections();
+    auto b1 = connections[0].bus.lock();
+    auto b2 = connections[1].bus.lock();
+    if (!b1 || !b2) {
+      throw std::runtime_error("Unexpected error! Pointer not existing!");
+    }
+
+    ParameterStamp stamp{busIdMap.at(b1->getId()), busIdMap.at(b2->getId()), 0.0, {}};
+    std::complex<double> unitCurrent = 0.0;
+    switch (type) {
+    case ComponentType::RESISTOR: {
+      // y = 1 / R.
+      const double resistance = std::static_pointer_cast<Resistor>(component)->getResistance();
+      stamp.admittanceDerivative = -1.0 / (resistance * resistance);
+      break;
+    }
+    case ComponentType::CAPACITOR:
+      // y = j * omega * C.
+      stamp.admittanceDerivative = std::complex<double>(0.0, omega);
+      break;
+    case ComponentType::INDUCTOR: {
+      // y = 1 / (j * omega * L).
+      const double inductance = std::static_pointer_cast<Inductor>(component)->getInductance();
+      stamp.admittanceDerivative =
+          -1.0 / std::complex<double>(0.0, omega * inductance * inductance);
+      break;
+    }
+    case ComponentType::DC_CURRENT_SOURCE:
+      unitCurrent = 1.0;
+      break;
+    case ComponentType::AC_CURRENT_SOURCE:
+      unitCurrent = std::complex<double>(ACCurrentSource::computePhasor(
+          1.0f, std::static_pointer_cast<ACCurrentSource>(component)->getPhase()));
+      break;
+    case ComponentType::DC_VOLTAGE_SOURCE:
+      stamp.currentDerivatives.emplace_back(transformer.getVoltageSourceRow(component->getId()),
+                                            1.0);
+      break;
+    case ComponentType::AC_VOLTAGE_SOURCE:
+      stamp.currentDerivatives.emplace_back(
+          transformer.getVoltageSourceRow(component->getId()),
+          std::complex<double>(ACVoltageSource::computePhasor(
+              1.0f, std::static_pointer_cast<ACVoltageSource>(component)->getPhase())));
+      break;
+    default:
+      throw std::runtime_error("Unsupported component type!");
+    }
+
+    if (unitCurrent != 0.0) {
+      const BusNumber buses[2] = {stamp.first, stamp.second};
+      for (size_t k = 0; k < 2; k++) {
+        if (buses[k] != 0) {
+          stamp.currentDerivatives.emplace_back(
+              buses[k] - 1,
+              connections[k].role == TerminalRole::POSITIVE ? unitCurrent : -unitCurrent);
+        }
+      }
+    }
+    result.componentIds.push_back(component->getId());
+    stamps.push_back(std::move(stamp));
+  }
+
+  // 3. One adjoint solve per output, then a pass over the components.
+  result.busIds = busIds;
+  result.voltages.zeros(outputs.size());
+  result.sensitivities.zeros(outputs.size(), stamps.size());
+  result.magnitudeSensitivities.zeros(outputs.size(), stamps.size());
+  for (size_t k = 0; k < outputs.size(); k++) {
+    if (outputs[k] == 0) {
+      continue; // Ground does not depend on anything.
+    }
+
+    arma::cx_vec unit(x.n_elem, arma::fill::zeros);
+    unit(outputs[k] - 1) = 1.0;
+    const arma::cx_vec lambda = factorization.solveTransposed(unit);
+    const std::complex<double> voltage = x(outputs[k] - 1);
+    result.voltages(k) = voltage;
+
+    for (size_t m = 0; m < stamps.size(); m++) {
+      const ParameterStamp &stamp = stamps[m];
+      std::complex<double> derivative = 0.0;
+      if (stamp.admittanceDerivative != 0.0) {
+        derivative -= stamp.admittanceDerivative *
+                      (getEntry(lambda, stamp.first) - getEntry(lambda, stamp.second)) *
+                      (getEntry(x, stamp.first) - getEntry(x, stamp.second));
+      }
+      for (const auto &[row, value] : stamp.currentDerivatives) {
+        derivative += lambda(row) * value;
+      }
+
+      result.sensitivities(k, m) = derivative;
+      // d|v| / dp = Re(conj(v) * dv / dp) / |v|.
+      if (std::abs(voltage) > 0.0) {
+        result.magnitudeSensitivities(k, m) =
+            std::real(std::conj(voltage) * derivative) / std::abs(voltage);
+      }
+    }
+  }
+  return result;
+}
+
+} // namespace ocira::core
@@ -0,0 +1,110 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        solution_cache.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: In-process cache of factorizations and solutions keyed by fingerprint.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "solution_cache.hpp"
+#include "circuit.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace ocira::core {
+
+SolutionCache::SolutionCache(size_t solutionCapacity, size_t factorizationCapacity,
+                             std::shared_ptr<const FactorizationStore> store)
+    : m_solutions(solutionCapacity), m_factorizations(factorizationCapacity),
+      m_store(std::move(store)) {}
+
+std::shared_ptr<const arma::cx_vec> SolutionCache::solve(const std::shared_ptr<Circuit> &circuit) {
+  const CircuitFingerprint fingerprint = CircuitFingerprinter::compute(*circuit);
+
+  // 1. Identical circuit: answer from the solution cache.
+  std::shared_ptr<const CircuitFactorization> factorization;
+  {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    if (auto solution = this->m_solutions.find(fingerprint.full)) {
+      return *solution;
+    }
+    if (auto cached = this->m_factorizations.find(fingerprint.admittance)) {
+      factorization = *cached;
+    }
+  }
+
+  // 2. Validate and transform. The lock is not held, so other circuits can be solved meanwhile.
+  ValidationOptions options;
+  options.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, options).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+
+  CircuitTransformer transformer(circuit);
+
+  // 3. Same admittance matrix: reuse the factorization, then try the store, otherwise factorize
+  // and keep it.
+  if (!factorization && this->m_store) {
+    factorization = this->m_store->load(fingerprint);
+  }
+  if (!factorization) {
+    factorization =
+        std::make_shared<const CircuitFactorization>(*transformer.getAdmittanceMatrix());
+    if (this->m_store) {
+      this->m_store->save(fingerprint, *factorization);
+    }
+  }
+  auto solution =
+      std::make_shared<const arma::cx_vec>(factorization->solve(*transformer.getCurrentVector()));
+
+  std::lock_guard<std::mutex> lock(this->m_mutex);
+  this->m_factorizations.insert(fingerprint.admittance, factorization);
+  this->m_solutions.insert(fingerprint.full, solution);
+  return solution;
+}
+
+CacheStatistics SolutionCache::getSolutionStatistics() const {
+  std::lock_guard<std::mutex> lock(this->m_mutex);
+  return this->m_solutions.getStatistics();
+}
+
+CacheStatistics SolutionCache::getFactorizationStatistics() const {
+  std::lock_guard<std::mutex> lock(this->m_mutex);
+  return this->m_factorizations.getStatistics();
+}
+
+void SolutionCache::clear() {
+  std::lock_guard<std::mutex> lock(this->m_mutex);
+  this->m_solutions.clear();
+  this->m_factorizations.clear();
+}
+
+} // namespace ocira::core
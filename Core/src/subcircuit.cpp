@@ -0,0 +1,168 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        subcircuit.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Reusable subcircuit definitions and their instances.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "subcircuit.hpp"
+#include "circuit_structs.hpp"
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+SubcircuitDefinition::SubcircuitDefinition(std::vector<std::shared_ptr<Bus>> buses,
+                                           std::vector<std::shared_ptr<Component>> components,
+                                           std::vector<BusId> ports)
+    : m_buses(std::move(buses)), m_components(std::move(components)), m_ports(std::move(ports)) {
+  // 1. Ports get the first local indices, in port order.
+  for (BusId port : this->m_ports) {
+    if (!this->m_localIndices.emplace(port, this->m_localIndices.size()).second) {
+      throw std::runtime_error("Duplicate subcircuit port!");
+    }
+  }
+
+  // 2. Internal buses follow in the order they were given.
+  uint32_t numberOfPortBuses = 0;
+  for (const std::shared_ptr<Bus> &bus : this->m_buses) {
+    if (this->m_localIndices.find(bus->getId()) != this->m_localIndices.end()) {
+      numberOfPortBuses++;
+      continue;
+    }
+    this->m_localIndices.emplace(bus->getId(), this->m_localIndices.size());
+  }
+
+  if (numberOfPortBuses != this->m_ports.size()) {
+    throw std::runtime_error("Subcircuit port is not a bus of the definition!");
+  }
+
+  // 3. Check the components and find out which ports are connected through the definition.
+  std::vector<uint32_t> parents(this->m_localIndices.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  auto find = [&parents](uint32_t index) {
+    while (parents[index] != index) {
+      parents[index] = parents[parents[index]];
+      index = parents[index];
+    }
+    return index;
+  };
+
+  for (const std::shared_ptr<Component> &component : this->m_components) {
+    switch (component->getComponentType()) {
+    case ComponentType::RESISTOR:
+    case ComponentType::CAPACITOR:
+    case ComponentType::INDUCTOR:
+    case ComponentType::DC_CURRENT_SOURCE:
+    case ComponentType::AC_CURRENT_SOURCE:
+    case ComponentType::WIRE:
+      break;
+    default:
+      throw std::runtime_error("Unsupported component type in subcircuit!");
+    }
+
+    if (!component->isConnected()) {
+      throw std::runtime_error("Subcircuit component without required connections!");
+    }
+
+    uint32_t first = UINT32_MAX;
+    for (const Connection &connection : component->getConnections()) {
+      std::shared_ptr<Bus> bus = connection.bus.lock();
+      if (!bus) {
+        throw std::runtime_error("Unexpected error! Pointer not existing!");
+      }
+
+      uint32_t index = this->getLocalIndex(bus->getId());
+      if (first == UINT32_MAX) {
+        first = index;
+      } else {
+        parents[find(index)] = find(first);
+      }
+    }
+  }
+
+  this->m_portGroups.reserve(this->m_ports.size());
+  for (uint32_t port = 0; port < this->m_ports.size(); port++) {
+    this->m_portGroups.push_back(find(port));
+  }
+}
+
+const std::vector<std::shared_ptr<Bus>> &SubcircuitDefinition::getBuses() const {
+  return this->m_buses;
+}
+
+const std::vector<std::shared_ptr<Component>> &SubcircuitDefinition::getComponents() const {
+  return this->m_components;
+}
+
+const std::vector<BusId> &SubcircuitDefinition::getPorts() const { return this->m_ports; }
+
+uint32_t SubcircuitDefinition::getNumberOfPorts() const noexcept {
+  return static_cast<uint32_t>(this->m_ports.size());
+}
+
+uint32_t SubcircuitDefinition::getNumberOfInternalBuses() const noexcept {
+  return static_cast<uint32_t>(this->m_localIndices.size() - this->m_ports.size());
+}
+
+uint32_t SubcircuitDefinition::getLocalIndex(BusId id) const {
+  auto it = this->m_localIndices.find(id);
+  if (it == this->m_localIndices.end()) {
+    throw std::runtime_error("Bus is not part of the subcircuit definition!");
+  }
+  return it->second;
+}
+
+const std::vector<uint32_t> &SubcircuitDefinition::getPortGroups() const {
+  return this->m_portGroups;
+}
+
+SubcircuitInstance::SubcircuitInstance(SubcircuitInstanceId id,
+                                       std::shared_ptr<const SubcircuitDefinition> definition,
+                                       std::vector<BusId> portBuses)
+    : m_id(id), m_definition(std::move(definition)), m_portBuses(std::move(portBuses)) {
+  if (!this->m_definition || this->m_portBuses.size() != this->m_definition->getNumberOfPorts()) {
+    throw std::runtime_error("Subcircuit instance does not match its definition!");
+  }
+}
+
+SubcircuitInstanceId SubcircuitInstance::getId() const noexcept { return this->m_id; }
+
+const std::shared_ptr<const SubcircuitDefinition> &
+SubcircuitInstance::getDefinition() const noexcept {
+  return this->m_definition;
+}
+
+const std::vector<BusId> &SubcircuitInstance::getPortBuses() const { return this->m_portBuses; }
+
+} // namespace ocira::core
@@ -0,0 +1,180 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        superposition_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Contributions of every independent source to the bus voltages.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Read voltage source rows from CircuitTransformer.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+#include "superposition_analysis.hpp"
+#include "ac_current_source.hpp"
+#include "ac_voltage_source.hpp"
+#include "circuit.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include "dc_current_source.hpp"
+#include "dc_voltage_source.hpp"
+#include <complex>
+#include <stdexcept>
+#include <utility>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+SuperpositionResult SuperpositionAnalysis::compute(const std::shared_ptr<const Circuit> &circuit) {
+  std::vector<BusId> busIds;
+  for (const auto &bus : circuit->getBuses()) {
+    busIds.push_back(bus->getId());
+  }
+  return compute(circuit, busIds);
+}
+
+SuperpositionResult SuperpositionAnalysis::compute(const std::shared_ptr<const Circuit> &circuit,
+                                                   const std::vector<BusId> &busIds) {
+  if (circuit->getSimulationMode() == SimulationMode::TRANSIENT) {
+    throw std::runtime_error("Superposition analysis needs a DC or AC circuit!");
+  }
+  if (!circuit->getSubcircuitInstances().empty()) {
+    throw std::runtime_error("Superposition analysis does not support subcircuit instances!");
+  }
+
+  ValidationOptions options;
+  options.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, options).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+
+  // 1. One transformation and factorization.
+  const CircuitTransformer transformer{CircuitSnapshot(circuit)};
+  const auto &busIdMap = transformer.getBusIdMap();
+  const arma::uword size = transformer.getCurrentVector()->n_elem;
+  const CircuitFactorization factorization(*transformer.getAdmittanceMatrix());
+
+  std::vector<BusNumber> outputs;
+  for (BusId busId : busIds) {
+    auto it = busIdMap.find(busId);
+    if (it == busIdMap.end()) {
+      throw std::runtime_error("Bus is not part of the circuit!");
+    }
+    outputs.push_back(it->second);
+  }
+
+  // 2. The entries of J that each source sets.
+
+  SuperpositionResult result;
+  std::vector<std::vector<std::pair<arma::uword, std::complex<double>>>> sources;
+  for (const auto &component : circuit->getComponents()) {
+    std::vector<std::pair<arma::uword, std::complex<double>>> entries;
+    std::complex<double> current = 0.0;
+    switch (component->getComponentType()) {
+    case ComponentType::DC_VOLTAGE_SOURCE:
+      entries.emplace_back(transformer.getVoltageSourceRow(component->getId()),
+                           std::static_pointer_cast<DCVoltageSource>(component)->getVolts());
+      break;
+    case ComponentType::AC_VOLTAGE_SOURCE:
+      entries.emplace_back(
+          transformer.getVoltageSourceRow(component->getId()),
+          std::complex<double>(std::static_pointer_cast<ACVoltageSource>(component)->getPhasor()));
+      break;
+    case ComponentType::DC_CURRENT_SOURCE:
+      current = std::static_pointer_cast<DCCurrentSource>(component)->getAmps();
+      break;
+    case ComponentType::AC_CURRENT_SOURCE:
+      current =
+          std::complex<double>(std::static_pointer_cast<ACCurrentSource>(component)->getPhasor());
+      break;
+    default:
+      continue;
+    }
+
+    // Current sources inject into the bus at their positive terminal.
+    if (current != 0.0) {
+      for (const Connection &connection : component->getConnections()) {
+        auto bus = connection.bus.lock();
+        if (!bus) {
+          throw std::runtime_error("Unexpected error! Pointer not existing!");
+        }
+        const BusNumber number = busIdMap.at(bus->getId());
+        if (number != 0) {
+          entries.emplace_back(number - 1,
+                               connection.role == TerminalRole::POSITIVE ? current : -current);
+        }
+      }
+    }
+    result.sourceIds.push_back(component->getId());
+    sources.push_back(std::move(entries));
+  }
+
+  // 3. Solve whichever block is smaller: one column per source or one transposed solve per bus.
+  result.busIds = busIds;
+  result.contributions.zeros(sources.size(), outputs.size());
+  if (sources.empty() || outputs.empty()) {
+    return result;
+  }
+
+  if (sources.size() <= outputs.size()) {
+    arma::cx_mat B(size, sources.size(), arma::fill::zeros);
+    for (size_t m = 0; m < sources.size(); m++) {
+      for (const auto &[row, value] : sources[m]) {
+        B(row, m) += value;
+      }
+    }
+    const arma::cx_mat X = factorization.solve(B);
+    for (size_t k = 0; k < outputs.size(); k++) {
+      if (outputs[k] == 0) {
+        continue; // Ground stays at zero.
+      }
+      for (size_t m = 0; m < sources.size(); m++) {
+        result.contributions(m, k) = X(outputs[k] - 1, m);
+      }
+    }
+  } else {
+    for (size_t k = 0; k < outputs.size(); k++) {
+      if (outputs[k] == 0) {
+        continue;
+      }
+      arma::cx_vec unit(size, arma::fill::zeros);
+      unit(outputs[k] - 1) = 1.0;
+      const arma::cx_vec lambda = factorization.solveTransposed(unit);
+      for (size_t m = 0; m < sources.size(); m++) {
+        std::complex<double> contribution = 0.0;
+        for (const auto &[row, value] : sources[m]) {
+          contribution += lambda(row) * value;
+        }
+        result.contributions(m, k) = contribution;
+      }
+    }
+  }
+  return result;
+}
+
+} // namespace ocira::core
@@ -0,0 +1,140 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        thevenin_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Thevenin and Norton equivalents seen between pairs of buses.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Treat ground pairs and pairs across voltage sources as shorts.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+#include "thevenin_analysis.hpp"
+#include "circuit.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+namespace {
+
+/// @brief Impedances up to this fraction of the norm of Y^-1 are rounding errors of a short.
+constexpr double RELATIVE_IMPEDANCE_TOLERANCE = 1e-12;
+
+} // namespace
+
+TheveninResult TheveninAnalysis::compute(const std::shared_ptr<const Circuit> &circuit,
+                                         const std::vector<BusPair> &pairs) {
+  if (circuit->getSimulationMode() == SimulationMode::TRANSIENT) {
+    throw std::runtime_error("Thevenin analysis needs a DC or AC circuit!");
+  }
+
+  ValidationOptions options;
+  options.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, options).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+
+  // 1. One transformation and factorization.
+  const CircuitTransformer transformer{CircuitSnapshot(circuit)};
+  const auto &busIdMap = transformer.getBusIdMap();
+  const arma::cx_vec &J = *transformer.getCurrentVector();
+  const CircuitFactorization factorization(*transformer.getAdmittanceMatrix());
+
+  std::vector<std::pair<BusNumber, BusNumber>> numbers;
+  for (const BusPair &pair : pairs) {
+    if (pair.positive == pair.negative) {
+      throw std::runtime_error("Bus pair repeats the same bus!");
+    }
+    auto positive = busIdMap.find(pair.positive);
+    auto negative = busIdMap.find(pair.negative);
+    if (positive == busIdMap.end() || negative == busIdMap.end()) {
+      throw std::runtime_error("Bus is not part of the circuit!");
+    }
+    numbers.emplace_back(positive->second, negative->second);
+  }
+
+  // 2. Column 0 is the circuit with its sources, column k + 1 the unit injection of pair k.
+  arma::cx_mat B(J.n_elem, pairs.size() + 1, arma::fill::zeros);
+  std::copy(J.memptr(), J.memptr() + J.n_elem, B.colptr(0));
+  for (size_t k = 0; k < numbers.size(); k++) {
+    if (numbers[k].first != 0) {
+      B(numbers[k].first - 1, k + 1) += 1.0;
+    }
+    if (numbers[k].second != 0) {
+      B(numbers[k].second - 1, k + 1) -= 1.0;
+    }
+  }
+  const arma::cx_mat X = factorization.solve(B);
+
+  // 3. Read the voltage across every pair from both solutions.
+  auto getVoltage = [&](size_t column, const std::pair<BusNumber, BusNumber> &pair) {
+    const std::complex<double> positive = pair.first != 0 ? X(pair.first - 1, column) : 0.0;
+    const std::complex<double> negative = pair.second != 0 ? X(pair.second - 1, column) : 0.0;
+    return positive - negative;
+  };
+
+  // The largest response to the unit injections estimates the norm of Y^-1.
+  double scale = 0.0;
+  for (arma::uword k = J.n_elem; k < X.n_elem; k++) {
+    scale = std::max(scale, std::abs(X(k)));
+  }
+
+  TheveninResult result;
+  result.pairs = pairs;
+  result.theveninVoltages.set_size(pairs.size());
+  result.theveninImpedances.set_size(pairs.size());
+  result.nortonCurrents.set_size(pairs.size());
+  result.nortonAdmittances.set_size(pairs.size());
+  for (size_t k = 0; k < numbers.size(); k++) {
+    const std::complex<double> voltage = getVoltage(0, numbers[k]);
+    const std::complex<double> impedance = getVoltage(k + 1, numbers[k]);
+    result.theveninVoltages(k) = voltage;
+    // Both buses ground, or held together by a voltage source: an ideal short.
+    if ((numbers[k].first == 0 && numbers[k].second == 0) ||
+        std::abs(impedance) <= RELATIVE_IMPEDANCE_TOLERANCE * scale) {
+      result.theveninImpedances(k) = 0.0;
+      result.nortonCurrents(k) = std::numeric_limits<double>::infinity();
+      result.nortonAdmittances(k) = std::numeric_limits<double>::infinity();
+      continue;
+    }
+    result.theveninImpedances(k) = impedance;
+    result.nortonCurrents(k) = voltage / impedance;
+    result.nortonAdmittances(k) = 1.0 / impedance;
+  }
+  return result;
+}
+
+} // namespace ocira::core
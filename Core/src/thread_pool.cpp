@@ -0,0 +1,141 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        thread_pool.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Fixed-size pool of worker threads.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Split batches into contiguous ranges.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace ocira::core {
+
+ThreadPool::ThreadPool(uint32_t numberOfThreads) : m_stopping(false) {
+  if (numberOfThreads == 0) {
+    numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  this->m_workers.reserve(numberOfThreads);
+  for (uint32_t k = 0; k < numberOfThreads; k++) {
+    this->m_workers.emplace_back(&ThreadPool::_work, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_stopping = true;
+  }
+  this->m_condition.notify_all();
+
+  for (std::thread &worker : this->m_workers) {
+    worker.join();
+  }
+}
+
+uint32_t ThreadPool::getNumberOfThreads() const noexcept {
+  return static_cast<uint32_t>(this->m_workers.size());
+}
+
+void ThreadPool::run(size_t numberOfTasks, const std::function<void(size_t)> &task) {
+  if (numberOfTasks == 0) {
+    return;
+  }
+
+  // State of the batch, shared by the tasks and the waiting caller.
+  std::mutex batchMutex;
+  std::condition_variable batchDone;
+  size_t remaining = numberOfTasks;
+  std::exception_ptr firstError;
+
+  {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    for (size_t index = 0; index < numberOfTasks; index++) {
+      this->m_queue.push([&, index]() {
+        std::exception_ptr error;
+        try {
+          task(index);
+        } catch (...) {
+          error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> batchLock(batchMutex);
+        if (error && !firstError) {
+          firstError = error;
+        }
+        if (--remaining == 0) {
+          batchDone.notify_one();
+        }
+      });
+    }
+  }
+  this->m_condition.notify_all();
+
+  std::unique_lock<std::mutex> lock(batchMutex);
+  batchDone.wait(lock, [&remaining]() { return remaining == 0; });
+
+  if (firstError) {
+    std::rethrow_exception(firstError);
+  }
+}
+
+size_t ThreadPool::getNumberOfRanges(size_t numberOfItems) const noexcept {
+  return std::min<size_t>(numberOfItems, this->m_workers.size());
+}
+
+void ThreadPool::runRanges(size_t numberOfItems,
+                           const std::function<void(size_t, size_t, size_t)> &range) {
+  const size_t numberOfTasks = this->getNumberOfRanges(numberOfItems);
+  this->run(numberOfTasks, [&](size_t task) {
+    range(task, numberOfItems * task / numberOfTasks, numberOfItems * (task + 1) / numberOfTasks);
+  });
+}
+
+// PRIVATE METHODS
+
+void ThreadPool::_work() {
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(this->m_mutex);
+      this->m_condition.wait(lock,
+                             [this]() { return this->m_stopping || !this->m_queue.empty(); });
+      if (this->m_queue.empty()) {
+        return;
+      }
+      job = std::move(this->m_queue.front());
+      this->m_queue.pop();
+    }
+    job();
+  }
+}
+
+} // namespace ocira::core
@@ -0,0 +1,513 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        transient_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Time-domain analysis with companion models of capacitors and inductors.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - 2026-10-19 Martin Vidjeskog: Number the system with CircuitTransformer::numberCircuit.
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "transient_analysis.hpp"
+#include "ac_current_source.hpp"
+#include "ac_voltage_source.hpp"
+#include "capacitor.hpp"
+#include "circuit.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_validator.hpp"
+#include "dc_current_source.hpp"
+#include "dc_voltage_source.hpp"
+#include "inductor.hpp"
+#include "resistor.hpp"
+#include "subcircuit.hpp"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <stdexcept>
+#include <utility>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+namespace {
+
+constexpr double TWO_PI = 6.283185307179586;
+
+/// @brief Adds a conductance between two buses to the system matrix. Bus number 0 is ground.
+void stampConductance(arma::cx_mat &Y, BusNumber i, BusNumber j, double conductance) {
+  if (i != 0) {
+    Y(i - 1, i - 1) += conductance;
+  }
+  if (j != 0) {
+    Y(j - 1, j - 1) += conductance;
+  }
+  if (i != 0 && j != 0) {
+    Y(i - 1, j - 1) -= conductance;
+    Y(j - 1, i - 1) -= conductance;
+  }
+}
+
+/// @brief Returns the bus number of a component connection.
+BusNumber getConnectionBusNumber(const Component &component, size_t connection,
+                                 const std::unordered_map<BusId, BusNumber> &busIdMap) {
+  auto bus = component.getConnections()[connection].bus.lock();
+  if (!bus) {
+    throw std::runtime_error("Unexpected error! Pointer not existing!");
+  }
+  return busIdMap.at(bus->getId());
+}
+
+/// @brief Returns the effective step of a step: the step itself for backward Euler and half of
+/// it for the trapezoidal rule, which has twice the capacitor conductance.
+double getEffectiveStep(double dt, IntegrationMethod method) {
+  return method == IntegrationMethod::TRAPEZOIDAL ? 0.5 * dt : dt;
+}
+
+/// @brief Capacitor voltages and inductor currents of an accepted step.
+struct StatePoint {
+  double time;
+  std::vector<double> values;
+};
+
+/// @brief Returns the largest ratio of estimated local truncation error to tolerance.
+/// The trapezoidal rule has an error of h^3 / 12 * x''' and backward Euler one of h^2 / 2 * x''.
+/// The derivatives come from divided differences over the newest points, which must hold four
+/// points for the trapezoidal rule and three for backward Euler.
+double getErrorRatio(const std::deque<StatePoint> &points, IntegrationMethod method,
+                     const AdaptiveTransientOptions &options) {
+  const size_t order = method == IntegrationMethod::TRAPEZOIDAL ? 3 : 2;
+  const size_t first = points.size() - order - 1;
+  const double h = points.back().time - points[points.size() - 2].time;
+  double ratio = 0.0;
+
+  std::vector<double> differences(order + 1);
+  for (size_t k = 0; k < points.back().values.size(); k++) {
+    for (size_t p = 0; p <= order; p++) {
+      differences[p] = points[first + p].values[k];
+    }
+    for (size_t level = 1; level <= order; level++) {
+      for (size_t p = order; p >= level; p--) {
+        differences[p] = (differences[p] - differences[p - 1]) /
+                         (points[first + p].time - points[first + p - level].time);
+      }
+    }
+
+    // differences[order] is x^(order) / order!.
+    const double error = method == IntegrationMethod::TRAPEZOIDAL
+                             ? h * h * h / 2.0 * std::abs(differences[order])
+                             : h * h * std::abs(differences[order]);
+    const double value = std::max(std::abs(points.back().values[k]),
+                                  std::abs(points[points.size() - 2].values[k]));
+    const double tolerance = options.relativeTolerance * value + options.absoluteTolerance;
+    ratio = std::max(ratio, error / tolerance);
+  }
+  return ratio;
+}
+
+} // namespace
+
+TransientAnalysis::TransientAnalysis(const std::shared_ptr<const Circuit> &circuit,
+                                     double timeStep, IntegrationMethod method,
+                                     size_t factorizationCacheSize)
+    : m_timeStep(timeStep), m_method(method), m_numberOfFactorizations(0),
+      m_factorizations(std::max<size_t>(factorizationCacheSize, 1)) {
+  if (circuit->getSimulationMode() != SimulationMode::TRANSIENT) {
+    throw std::runtime_error("Transient analysis needs a transient circuit!");
+  }
+  if (!(timeStep > 0.0)) {
+    throw std::runtime_error("Timestep must be positive!");
+  }
+
+  ValidationOptions options;
+  options.failFast = true;
+  if (!CircuitValidator::isValidCircuit(*circuit, options).isValid) {
+    throw std::runtime_error("Circuit is not valid!");
+  }
+  this->m_angularFrequency = TWO_PI * circuit->getFrequency();
+
+  // 1. Number the buses and voltage sources as CircuitTransformer does.
+  MnaNumbering numbering = CircuitTransformer::numberCircuit(*circuit);
+  this->m_busIdMap = std::move(numbering.busIdMap);
+  this->m_sizeG = numbering.sizeG;
+
+  // 2. Allocate the matrix: the buses, then an auxiliary row per voltage source.
+  const arma::uword size = this->m_sizeG + numbering.sizeB;
+  this->m_baseMatrix.zeros(size, size);
+
+  // 3. Stamp everything that does not depend on the step: resistors and voltage source
+  // couplings. Reactive branches and sources are collected.
+  for (const auto &component : circuit->getComponents()) {
+    const ComponentType type = component->getComponentType();
+    if (type == ComponentType::GROUND || type == ComponentType::WIRE) {
+      continue;
+    }
+
+    const BusNumber first = getConnectionBusNumber(*component, 0, this->m_busIdMap);
+    const BusNumber second = getConnectionBusNumber(*component, 1, this->m_busIdMap);
+    if (type != ComponentType::DC_VOLTAGE_SOURCE && type != ComponentType::AC_VOLTAGE_SOURCE) {
+      this->_addComponent(*component, first, second);
+      continue;
+    }
+
+    // Voltage source: +-1 couplings with its auxiliary row, the voltage goes to the right-hand
+    // side of that row.
+    const arma::uword row = numbering.voltageSourceRows.at(component->getId());
+    const auto &connections = component->getConnections();
+    const BusNumber buses[2] = {first, second};
+    for (size_t k = 0; k < 2; k++) {
+      if (buses[k] != 0) {
+        const double sign = connections[k].role == TerminalRole::POSITIVE ? 1.0 : -1.0;
+        this->m_baseMatrix(row, buses[k] - 1) += sign;
+        this->m_baseMatrix(buses[k] - 1, row) += sign;
+      }
+    }
+
+    TransientSource source;
+    if (type == ComponentType::DC_VOLTAGE_SOURCE) {
+      source = {static_cast<const DCVoltageSource &>(*component).getVolts(), 0.0, false, {}};
+    } else {
+      const auto &ac = static_cast<const ACVoltageSource &>(*component);
+      source = {ac.getAmplitude(), ac.getPhase() * TWO_PI / 360.0, true, {}};
+    }
+    source.entries.emplace_back(row, 1.0);
+    this->m_sources.push_back(std::move(source));
+  }
+
+  const auto &instances = circuit->getSubcircuitInstances();
+  for (size_t k = 0; k < instances.size(); k++) {
+    const SubcircuitDefinition &definition = *instances[k]->getDefinition();
+    const uint32_t ports = definition.getNumberOfPorts();
+    auto localToBusNumber = [&](const Component &component, size_t connection) -> BusNumber {
+      auto bus = component.getConnections()[connection].bus.lock();
+      if (!bus) {
+        throw std::runtime_error("Unexpected error! Pointer not existing!");
+      }
+      const uint32_t local = definition.getLocalIndex(bus->getId());
+      if (local < ports) {
+        return this->m_busIdMap.at(instances[k]->getPortBuses()[local]);
+      }
+      return numbering.instanceNodeOffsets[k] + local - ports;
+    };
+
+    for (const auto &component : definition.getComponents()) {
+      if (component->getComponentType() != ComponentType::WIRE) {
+        this->_addComponent(*component, localToBusNumber(*component, 0),
+                            localToBusNumber(*component, 1));
+      }
+    }
+  }
+
+  // 4. Start from rest and factorize for the initial step, so that a singular system is
+  // reported here.
+  this->m_state = {0.0, 0, 0.0, 0, arma::vec(size, arma::fill::zeros),
+                   std::vector<double>(this->m_reactiveBranches.size(), 0.0),
+                   std::vector<double>(this->m_reactiveBranches.size(), 0.0)};
+  this->_getFactorization(getEffectiveStep(timeStep, method));
+}
+
+void TransientAnalysis::step() {
+  IntegrationState &state = this->m_state;
+  if (this->m_method == IntegrationMethod::TRAPEZOIDAL && state.numberOfSteps == 0) {
+    // Backward Euler over h / 2 has the same conductances as the trapezoidal rule over h.
+    this->_advance(0.5 * this->m_timeStep, IntegrationMethod::BACKWARD_EULER);
+    this->_advance(0.5 * this->m_timeStep, IntegrationMethod::BACKWARD_EULER);
+  } else {
+    this->_advance(this->m_timeStep, this->m_method);
+  }
+
+  // Land exactly on the step grid, regardless of rounding in the steps.
+  state.segmentSteps++;
+  state.time = state.segmentStart + static_cast<double>(state.segmentSteps) * this->m_timeStep;
+  state.numberOfSteps++;
+}
+
+void TransientAnalysis::setTimeStep(double timeStep) {
+  if (!(timeStep > 0.0)) {
+    throw std::runtime_error("Timestep must be positive!");
+  }
+  if (timeStep != this->m_timeStep) {
+    this->m_timeStep = timeStep;
+    this->m_state.segmentStart = this->m_state.time;
+    this->m_state.segmentSteps = 0;
+  }
+}
+
+double TransientAnalysis::getTimeStep() const noexcept { return this->m_timeStep; }
+
+double TransientAnalysis::getTime() const noexcept { return this->m_state.time; }
+
+uint64_t TransientAnalysis::getNumberOfSteps() const noexcept {
+  return this->m_state.numberOfSteps;
+}
+
+uint64_t TransientAnalysis::getNumberOfFactorizations() const noexcept {
+  return this->m_numberOfFactorizations;
+}
+
+const arma::vec &TransientAnalysis::getSolution() const noexcept { return this->m_state.solution; }
+
+const std::unordered_map<BusId, BusNumber> &TransientAnalysis::getBusIdMap() const noexcept {
+  return this->m_busIdMap;
+}
+
+TransientResult TransientAnalysis::run(const std::shared_ptr<const Circuit> &circuit,
+                                       const TransientOptions &options) {
+  if (!(options.stopTime > 0.0)) {
+    throw std::runtime_error("Stop time must be positive!");
+  }
+
+  TransientAnalysis analysis(circuit, options.timeStep, options.method);
+  // The small offset keeps a stop time that is a multiple of the step from adding a step.
+  const uint64_t numberOfSteps =
+      static_cast<uint64_t>(std::ceil(options.stopTime / options.timeStep - 1e-9));
+
+  TransientResult result;
+  result.times.reserve(numberOfSteps);
+  result.solutions.set_size(analysis.getSolution().n_elem, numberOfSteps);
+  for (uint64_t k = 0; k < numberOfSteps; k++) {
+    analysis.step();
+    result.times.push_back(analysis.getTime());
+    const arma::vec &solution = analysis.getSolution();
+    std::copy(solution.memptr(), solution.memptr() + solution.n_elem, result.solutions.colptr(k));
+  }
+  result.numberOfFactorizations = analysis.getNumberOfFactorizations();
+  return result;
+}
+
+TransientResult TransientAnalysis::runAdaptive(const std::shared_ptr<const Circuit> &circuit,
+                                               const AdaptiveTransientOptions &options) {
+  if (!(options.stopTime > 0.0) || !(options.minStep > 0.0) ||
+      !(options.minStep <= options.initialStep) || !(options.initialStep <= options.maxStep) ||
+      !(options.relativeTolerance >= 0.0) || !(options.absoluteTolerance > 0.0)) {
+    throw std::runtime_error("Invalid adaptive transient settings!");
+  }
+
+  TransientAnalysis analysis(circuit, options.initialStep, options.method,
+                             options.factorizationCacheSize);
+  const double order = options.method == IntegrationMethod::TRAPEZOIDAL ? 2.0 : 1.0;
+  const size_t numberOfPoints = options.method == IntegrationMethod::TRAPEZOIDAL ? 4 : 3;
+
+  // Steps are initialStep * 2^exponent, so that only a few distinct factorizations occur.
+  const int minExponent =
+      static_cast<int>(std::ceil(std::log2(options.minStep / options.initialStep)));
+  const int maxExponent =
+      static_cast<int>(std::floor(std::log2(options.maxStep / options.initialStep)));
+  int exponent = 0;
+
+  auto getStateValues = [&]() {
+    std::vector<double> values(analysis.m_reactiveBranches.size());
+    for (size_t k = 0; k < values.size(); k++) {
+      values[k] = analysis.m_reactiveBranches[k].isInductor ? analysis.m_state.currents[k]
+                                                            : analysis.m_state.voltages[k];
+    }
+    return values;
+  };
+
+  std::deque<StatePoint> points;
+  points.push_back({0.0, getStateValues()});
+
+  TransientResult result;
+  std::vector<arma::vec> solutions;
+  while (analysis.getTime() < options.stopTime) {
+    const double remaining = options.stopTime - analysis.getTime();
+    const double step = std::ldexp(options.initialStep, exponent);
+    // Shorten the last step instead of overshooting. Tiny remainders are merged into it.
+    analysis.setTimeStep(remaining < 1.5 * step ? remaining : step);
+
+    const IntegrationState saved = analysis.m_state;
+    analysis.step();
+    points.push_back({analysis.getTime(), getStateValues()});
+
+    double ratio = 0.0;
+    if (points.size() >= numberOfPoints) {
+      while (points.size() > numberOfPoints) {
+        points.pop_front();
+      }
+      ratio = getErrorRatio(points, options.method, options);
+    }
+
+    if (ratio > 1.0) {
+      if (exponent <= minExponent) {
+        throw std::runtime_error("Tolerance cannot be met with the minimum timestep!");
+      }
+      // Undo the step and retry with a step that the error model expects to pass.
+      analysis.m_state = saved;
+      points.pop_back();
+      result.numberOfRejectedSteps++;
+      const double shrink = 0.9 * std::pow(ratio, -1.0 / (order + 1.0));
+      exponent = std::max(minExponent,
+                          exponent - std::max(1, static_cast<int>(std::ceil(-std::log2(shrink)))));
+      continue;
+    }
+
+    result.times.push_back(analysis.getTime());
+    solutions.push_back(analysis.getSolution());
+
+    // Double the step once the error model predicts that twice the step still passes.
+    if (points.size() >= numberOfPoints && exponent < maxExponent &&
+        0.9 * std::pow(ratio, -1.0 / (order + 1.0)) >= 2.0) {
+      exponent++;
+    }
+  }
+
+  result.solutions.set_size(analysis.getSolution().n_elem, solutions.size());
+  for (size_t k = 0; k < solutions.size(); k++) {
+    std::copy(solutions[k].memptr(), solutions[k].memptr() + solutions[k].n_elem,
+              result.solutions.colptr(k));
+  }
+  result.numberOfFactorizations = analysis.getNumberOfFactorizations();
+  return result;
+}
+
+// PRIVATE METHODS
+
+void TransientAnalysis::_addComponent(const Component &component, BusNumber first,
+                                      BusNumber second) {
+  const auto &connections = component.getConnections();
+  TransientSource source;
+
+  switch (component.getComponentType()) {
+  case ComponentType::RESISTOR:
+    stampConductance(this->m_baseMatrix, first, second,
+                     static_cast<const Resistor &>(component).getConductance());
+    return;
+  case ComponentType::CAPACITOR:
+  case ComponentType::INDUCTOR: {
+    ReactiveBranch branch;
+    branch.first = first;
+    branch.second = second;
+    branch.isInductor = component.getComponentType() == ComponentType::INDUCTOR;
+    branch.value = branch.isInductor
+                       ? static_cast<const Inductor &>(component).getInductance()
+                       : static_cast<const Capacitor &>(component).getCapacitance();
+    if (!(branch.value > 0.0)) {
+      throw std::runtime_error("Capacitance and inductance must be positive!");
+    }
+    this->m_reactiveBranches.push_back(branch);
+    return;
+  }
+  case ComponentType::DC_CURRENT_SOURCE:
+    source = {static_cast<const DCCurrentSource &>(component).getAmps(), 0.0, false, {}};
+    break;
+  case ComponentType::AC_CURRENT_SOURCE: {
+    const auto &ac = static_cast<const ACCurrentSource &>(component);
+    source = {ac.getAmplitude(), ac.getPhase() * TWO_PI / 360.0, true, {}};
+    break;
+  }
+  default:
+    throw std::runtime_error("Unsupported component type!");
+  }
+
+  // Current sources inject into the bus at their positive terminal.
+  const BusNumber buses[2] = {first, second};
+  for (size_t k = 0; k < 2; k++) {
+    if (buses[k] != 0) {
+      source.entries.emplace_back(buses[k] - 1,
+                                  connections[k].role == TerminalRole::POSITIVE ? 1.0 : -1.0);
+    }
+  }
+  this->m_sources.push_back(std::move(source));
+}
+
+double TransientAnalysis::_getConductance(const ReactiveBranch &branch,
+                                          double effectiveStep) noexcept {
+  return branch.isInductor ? effectiveStep / branch.value : branch.value / effectiveStep;
+}
+
+std::shared_ptr<const CircuitFactorization>
+TransientAnalysis::_getFactorization(double effectiveStep) {
+  if (auto cached = this->m_factorizations.find(effectiveStep)) {
+    return *cached;
+  }
+
+  arma::cx_mat Y = this->m_baseMatrix;
+  for (const ReactiveBranch &branch : this->m_reactiveBranches) {
+    stampConductance(Y, branch.first, branch.second, _getConductance(branch, effectiveStep));
+  }
+  auto factorization = std::make_shared<const CircuitFactorization>(Y);
+  this->m_numberOfFactorizations++;
+  this->m_factorizations.insert(effectiveStep, factorization);
+  return factorization;
+}
+
+void TransientAnalysis::_advance(double dt, IntegrationMethod method) {
+  IntegrationState &state = this->m_state;
+  const double effectiveStep = getEffectiveStep(dt, method);
+  const std::shared_ptr<const CircuitFactorization> factorization =
+      this->_getFactorization(effectiveStep);
+
+  const double time = state.time + dt;
+  arma::cx_vec J(state.solution.n_elem, arma::fill::zeros);
+  for (const TransientSource &source : this->m_sources) {
+    const double value = source.isAlternating
+                             ? source.amplitude * std::cos(this->m_angularFrequency * time +
+                                                           source.phase)
+                             : source.amplitude;
+    for (const auto &[row, sign] : source.entries) {
+      J(row) += sign * value;
+    }
+  }
+
+  // Companion model: the branch current is G * v + history, flowing from the first bus to the
+  // second one, so the history current leaves the first bus.
+  std::vector<double> histories(this->m_reactiveBranches.size());
+  for (size_t k = 0; k < this->m_reactiveBranches.size(); k++) {
+    const ReactiveBranch &branch = this->m_reactiveBranches[k];
+    const double G = _getConductance(branch, effectiveStep);
+    const bool trapezoidal = method == IntegrationMethod::TRAPEZOIDAL;
+    double history;
+    if (branch.isInductor) {
+      history = trapezoidal ? state.currents[k] + G * state.voltages[k] : state.currents[k];
+    } else {
+      history = trapezoidal ? -G * state.voltages[k] - state.currents[k] : -G * state.voltages[k];
+    }
+    histories[k] = history;
+    if (branch.first != 0) {
+      J(branch.first - 1) -= history;
+    }
+    if (branch.second != 0) {
+      J(branch.second - 1) += history;
+    }
+  }
+
+  arma::cx_vec x = factorization->solve(J);
+  for (arma::uword k = 0; k < x.n_elem; k++) {
+    state.solution(k) = x(k).real();
+  }
+
+  for (size_t k = 0; k < this->m_reactiveBranches.size(); k++) {
+    const ReactiveBranch &branch = this->m_reactiveBranches[k];
+    const double first = branch.first != 0 ? state.solution(branch.first - 1) : 0.0;
+    const double second = branch.second != 0 ? state.solution(branch.second - 1) : 0.0;
+    state.voltages[k] = first - second;
+    state.currents[k] = _getConductance(branch, effectiveStep) * state.voltages[k] + histories[k];
+  }
+  state.time = time;
+}
+
+} // namespace ocira::core
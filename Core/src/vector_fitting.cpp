@@ -0,0 +1,421 @@
+//==============================================================================
+// Project:     OCIRA (core library)
+// File:        vector_fitting.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Rational pole-residue macromodels of frequency responses.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Revision History:
+// - 2026-10-19 Martin Vidjeskog: Initial creation
+// - [YYYY-MM-DD] [Contributor]: [Description of change]
+//==============================================================================
+// Notes:
+// - Please retain this header in all redistributed versions.
+//==============================================================================
+
+#include "vector_fitting.hpp"
+#include "circuit.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_transformer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+using namespace ocira::core::components;
+
+namespace ocira::core {
+
+namespace {
+
+constexpr double TWO_PI = 6.283185307179586;
+
+/// @brief Returns the partial fraction basis of a pole set at the sample points.
+/// A real pole p contributes 1 / (s - p). A conjugate pair (a, a*) contributes
+/// 1 / (s - a) + 1 / (s - a*) and j / (s - a) - j / (s - a*), so that real coefficients c1 and c2
+/// stand for the residues c1 + j * c2 and c1 - j * c2.
+arma::cx_mat buildBasis(const arma::cx_vec &poles,
+                        const std::vector<std::complex<double>> &points) {
+  const std::complex<double> j(0.0, 1.0);
+  arma::cx_mat basis(points.size(), poles.n_elem);
+  for (arma::uword n = 0; n < poles.n_elem;) {
+    const std::complex<double> a = poles(n);
+    for (size_t k = 0; k < points.size(); k++) {
+      if (a.imag() == 0.0) {
+        basis(k, n) = 1.0 / (points[k] - a);
+      } else {
+        const std::complex<double> first = 1.0 / (points[k] - a);
+        const std::complex<double> second = 1.0 / (points[k] - std::conj(a));
+        basis(k, n) = first + second;
+        basis(k, n + 1) = j * first - j * second;
+      }
+    }
+    n += a.imag() == 0.0 ? 1 : 2;
+  }
+  return basis;
+}
+
+/// @brief Appends a column of ones for the constant term to a basis.
+arma::cx_mat appendConstant(const arma::cx_mat &basis) {
+  arma::cx_mat extended(basis.n_rows, basis.n_cols + 1);
+  for (arma::uword row = 0; row < basis.n_rows; row++) {
+    for (arma::uword column = 0; column < basis.n_cols; column++) {
+      extended(row, column) = basis(row, column);
+    }
+    extended(row, basis.n_cols) = 1.0;
+  }
+  return extended;
+}
+
+/// @brief Splits complex equations into real ones: the real parts on top of the imaginary parts.
+arma::mat stackRealImaginary(const arma::cx_mat &matrix) {
+  arma::mat stacked(2 * matrix.n_rows, matrix.n_cols);
+  for (arma::uword column = 0; column < matrix.n_cols; column++) {
+    for (arma::uword row = 0; row < matrix.n_rows; row++) {
+      stacked(row, column) = matrix(row, column).real();
+      stacked(matrix.n_rows + row, column) = matrix(row, column).imag();
+    }
+  }
+  return stacked;
+}
+
+/// @brief Solves A * X = B in the least squares sense, with the columns of A scaled to unit norm.
+/// Basis functions of poles far apart in frequency differ in magnitude by orders of magnitude,
+/// and the scaling keeps the problem well conditioned.
+arma::mat solveLeastSquares(const arma::mat &A, const arma::mat &B) {
+  arma::mat scaled = A;
+  std::vector<double> norms(A.n_cols, 1.0);
+  for (arma::uword column = 0; column < A.n_cols; column++) {
+    double sum = 0.0;
+    for (arma::uword row = 0; row < A.n_rows; row++) {
+      sum += A(row, column) * A(row, column);
+    }
+    if (sum > 0.0) {
+      norms[column] = std::sqrt(sum);
+      for (arma::uword row = 0; row < A.n_rows; row++) {
+        scaled(row, column) /= norms[column];
+      }
+    }
+  }
+
+  arma::mat X;
+  if (!arma::solve(X, scaled, B)) {
+    throw std::runtime_error("Vector fitting least squares problem is singular!");
+  }
+  for (arma::uword row = 0; row < X.n_rows; row++) {
+    for (arma::uword column = 0; column < X.n_cols; column++) {
+      X(row, column) /= norms[row];
+    }
+  }
+  return X;
+}
+
+/// @brief Returns starting poles: conjugate pairs with lightly damped, logarithmically spaced
+/// imaginary parts across the band, plus one real pole if the order is odd.
+arma::cx_vec initialPoles(uint32_t numberOfPoles, double lowest, double highest) {
+  arma::cx_vec poles(numberOfPoles);
+  const uint32_t numberOfPairs = numberOfPoles / 2;
+  lowest = std::max(lowest, highest * 1e-3);
+  arma::uword n = 0;
+  if (numberOfPoles % 2 == 1) {
+    poles(n++) = std::complex<double>(-std::sqrt(lowest * highest), 0.0);
+  }
+  for (uint32_t pair = 0; pair < numberOfPairs; pair++) {
+    const double ratio = numberOfPairs > 1 ? double(pair) / (numberOfPairs - 1) : 0.5;
+    const double beta = lowest * std::pow(highest / lowest, ratio);
+    poles(n++) = std::complex<double>(-beta / 100.0, beta);
+    poles(n++) = std::complex<double>(-beta / 100.0, -beta);
+  }
+  return poles;
+}
+
+/// @brief Orders new poles as the basis expects them: real poles, then conjugate pairs with the
+/// positive imaginary part first. Unstable poles are reflected into the left half plane.
+arma::cx_vec arrangePoles(const arma::cx_vec &eigenvalues) {
+  std::vector<std::complex<double>> real;
+  std::vector<std::complex<double>> upper;
+  size_t numberOfLower = 0;
+  for (arma::uword k = 0; k < eigenvalues.n_elem; k++) {
+    std::complex<double> pole = eigenvalues(k);
+    if (pole.real() > 0.0) {
+      pole = std::complex<double>(-pole.real(), pole.imag());
+    }
+    if (std::abs(pole.imag()) <= 1e-10 * std::abs(pole)) {
+      real.emplace_back(pole.real(), 0.0);
+    } else if (pole.imag() > 0.0) {
+      upper.push_back(pole);
+    } else {
+      numberOfLower++;
+    }
+  }
+  if (upper.size() != numberOfLower) {
+    throw std::runtime_error("Vector fitting poles are not in conjugate pairs!");
+  }
+
+  arma::cx_vec poles(eigenvalues.n_elem);
+  arma::uword n = 0;
+  for (const auto &pole : real) {
+    poles(n++) = pole;
+  }
+  for (const auto &pole : upper) {
+    poles(n++) = pole;
+    poles(n++) = std::conj(pole);
+  }
+  return poles;
+}
+
+} // namespace
+
+RationalModel::RationalModel(arma::cx_vec poles, arma::cx_mat residues, arma::cx_vec constants)
+    : m_poles(std::move(poles)), m_residues(std::move(residues)),
+      m_constants(std::move(constants)) {
+  if (this->m_residues.n_cols != this->m_poles.n_elem ||
+      this->m_residues.n_rows != this->m_constants.n_elem) {
+    throw std::runtime_error("Rational model dimensions do not match!");
+  }
+}
+
+arma::cx_vec RationalModel::evaluate(float frequency) const {
+  const std::complex<double> s(0.0, TWO_PI * frequency);
+  arma::cx_vec values = this->m_constants;
+  for (arma::uword n = 0; n < this->m_poles.n_elem; n++) {
+    const std::complex<double> fraction = 1.0 / (s - this->m_poles(n));
+    for (arma::uword m = 0; m < values.n_elem; m++) {
+      values(m) += this->m_residues(m, n) * fraction;
+    }
+  }
+  return values;
+}
+
+arma::cx_mat RationalModel::evaluate(const std::vector<float> &frequencies) const {
+  arma::cx_mat values(this->getNumberOfResponses(), frequencies.size());
+  for (size_t k = 0; k < frequencies.size(); k++) {
+    arma::cx_vec column = this->evaluate(frequencies[k]);
+    std::copy(column.memptr(), column.memptr() + column.n_elem, values.colptr(k));
+  }
+  return values;
+}
+
+const arma::cx_vec &RationalModel::getPoles() const noexcept { return this->m_poles; }
+
+const arma::cx_mat &RationalModel::getResidues() const noexcept { return this->m_residues; }
+
+const arma::cx_vec &RationalModel::getConstants() const noexcept { return this->m_constants; }
+
+arma::uword RationalModel::getNumberOfPoles() const noexcept { return this->m_poles.n_elem; }
+
+arma::uword RationalModel::getNumberOfResponses() const noexcept {
+  return this->m_constants.n_elem;
+}
+
+VectorFittingResult VectorFitting::fit(const FrequencySweepResult &sweep,
+                                       const std::vector<arma::uword> &rows,
+                                       const VectorFittingOptions &options) {
+  if (rows.empty()) {
+    throw std::runtime_error("No responses selected for vector fitting!");
+  }
+
+  std::vector<std::complex<double>> points(sweep.frequencies.size());
+  for (size_t k = 0; k < points.size(); k++) {
+    points[k] = std::complex<double>(0.0, TWO_PI * sweep.frequencies[k]);
+  }
+
+  arma::cx_mat responses(points.size(), rows.size());
+  for (size_t m = 0; m < rows.size(); m++) {
+    if (rows[m] >= sweep.solutions.n_rows) {
+      throw std::runtime_error("Selected response is not part of the sweep!");
+    }
+    for (size_t k = 0; k < points.size(); k++) {
+      responses(k, m) = sweep.solutions(rows[m], k);
+    }
+  }
+
+  if (options.numberOfPoles > 0) {
+    return _fitOrder(points, responses, options.numberOfPoles, options.iterations);
+  }
+
+  // Grow the order until the fit is good enough, keeping the best fit seen.
+  VectorFittingResult best = _fitOrder(points, responses, 2, options.iterations);
+  for (uint32_t order = 4; order <= options.maxPoles && best.relativeRmsError > options.tolerance;
+       order += 2) {
+    if (2 * points.size() < order + 1) {
+      break;
+    }
+    VectorFittingResult candidate = _fitOrder(points, responses, order, options.iterations);
+    if (candidate.relativeRmsError < best.relativeRmsError) {
+      best = std::move(candidate);
+    }
+  }
+  return best;
+}
+
+VectorFittingResult VectorFitting::fitBuses(const std::shared_ptr<const Circuit> &circuit,
+                                            const FrequencySweepResult &sweep,
+                                            const std::vector<BusId> &buses,
+                                            const VectorFittingOptions &options) {
+  CircuitTransformer transformer{CircuitSnapshot(circuit)};
+  std::vector<arma::uword> rows;
+  rows.reserve(buses.size());
+  for (BusId id : buses) {
+    auto it = transformer.getBusIdMap().find(id);
+    if (it == transformer.getBusIdMap().end() || it->second == 0) {
+      throw std::runtime_error("Bus is unknown or grounded!");
+    }
+    rows.push_back(it->second - 1);
+  }
+  return fit(sweep, rows, options);
+}
+
+// PRIVATE METHODS
+
+VectorFittingResult VectorFitting::_fitOrder(const std::vector<std::complex<double>> &points,
+                                             const arma::cx_mat &responses,
+                                             uint32_t numberOfPoles, uint32_t iterations) {
+  const arma::uword K = points.size();
+  const arma::uword M = responses.n_cols;
+  const arma::uword N = numberOfPoles;
+  if (2 * K < N + 1) {
+    throw std::runtime_error("Too few frequency samples for the number of poles!");
+  }
+
+  double lowest = std::abs(points[0].imag());
+  double highest = lowest;
+  for (const auto &point : points) {
+    lowest = std::min(lowest, std::abs(point.imag()));
+    highest = std::max(highest, std::abs(point.imag()));
+  }
+  arma::cx_vec poles = initialPoles(numberOfPoles, lowest, std::max(highest, 1.0));
+
+  for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+    // Unknowns per response: residues c_m and constant d_m. Shared by all responses: residues
+    // c~ of sigma(s) = 1 + sum c~_n * basis_n(s). Each response gives the equations
+    // basis * c_m + d_m - H_m * basis * c~ = H_m.
+    arma::cx_mat basis = buildBasis(poles, points);
+
+    arma::cx_mat coupled(K, M * (N + 1));
+    for (arma::uword m = 0; m < M; m++) {
+      for (arma::uword k = 0; k < K; k++) {
+        for (arma::uword n = 0; n < N; n++) {
+          coupled(k, m * (N + 1) + n) = -responses(k, m) * basis(k, n);
+        }
+        coupled(k, m * (N + 1) + N) = responses(k, m);
+      }
+    }
+
+    // Remove the part of every response's equations that c_m and d_m can explain. What is left
+    // only involves c~, and stacking it for all responses gives one small problem for c~.
+    arma::mat A1 = stackRealImaginary(appendConstant(basis));
+    arma::mat X = stackRealImaginary(coupled);
+    arma::mat projected = X - A1 * solveLeastSquares(A1, X);
+
+    const arma::uword rowsPerResponse = 2 * K;
+    arma::mat A(M * rowsPerResponse, N);
+    arma::mat b(M * rowsPerResponse, 1);
+    for (arma::uword m = 0; m < M; m++) {
+      for (arma::uword row = 0; row < rowsPerResponse; row++) {
+        for (arma::uword n = 0; n < N; n++) {
+          A(m * rowsPerResponse + row, n) = projected(row, m * (N + 1) + n);
+        }
+        b(m * rowsPerResponse + row, 0) = projected(row, m * (N + 1) + N);
+      }
+    }
+    arma::mat sigmaResidues = solveLeastSquares(A, b);
+
+    // The zeros of sigma(s) become the new poles: the eigenvalues of A~ - b~ * c~^T, where A~
+    // and b~ are the real state space realization of the basis.
+    arma::cx_mat H(N, N, arma::fill::zeros);
+    arma::cx_vec input(N, arma::fill::zeros);
+    for (arma::uword n = 0; n < N;) {
+      const std::complex<double> a = poles(n);
+      if (a.imag() == 0.0) {
+        H(n, n) = a.real();
+        input(n) = 1.0;
+        n += 1;
+      } else {
+        H(n, n) = a.real();
+        H(n, n + 1) = a.imag();
+        H(n + 1, n) = -a.imag();
+        H(n + 1, n + 1) = a.real();
+        input(n) = 2.0;
+        n += 2;
+      }
+    }
+    for (arma::uword row = 0; row < N; row++) {
+      for (arma::uword column = 0; column < N; column++) {
+        H(row, column) -= input(row) * sigmaResidues(column, 0);
+      }
+    }
+
+    arma::cx_vec eigenvalues;
+    if (!arma::eig_gen(eigenvalues, H)) {
+      throw std::runtime_error("Vector fitting pole relocation failed!");
+    }
+    poles = arrangePoles(eigenvalues);
+  }
+
+  // Residues and constants for the final poles, all responses at once.
+  arma::mat coefficients = solveLeastSquares(
+      stackRealImaginary(appendConstant(buildBasis(poles, points))), stackRealImaginary(responses));
+
+  const std::complex<double> j(0.0, 1.0);
+  arma::cx_mat residues(M, N);
+  arma::cx_vec constants(M);
+  for (arma::uword m = 0; m < M; m++) {
+    for (arma::uword n = 0; n < N;) {
+      if (poles(n).imag() == 0.0) {
+        residues(m, n) = coefficients(n, m);
+        n += 1;
+      } else {
+        residues(m, n) = coefficients(n, m) + j * coefficients(n + 1, m);
+        residues(m, n + 1) = std::conj(residues(m, n));
+        n += 2;
+      }
+    }
+    constants(m) = coefficients(N, m);
+  }
+
+  VectorFittingResult result;
+  result.model = std::make_shared<const RationalModel>(poles, residues, constants);
+  result.numberOfPoles = N;
+
+  // Quality on the fitted samples.
+  double squaredError = 0.0;
+  double squaredValue = 0.0;
+  result.maxError = 0.0;
+  for (arma::uword k = 0; k < K; k++) {
+    for (arma::uword m = 0; m < M; m++) {
+      std::complex<double> value = constants(m);
+      for (arma::uword n = 0; n < N; n++) {
+        value += residues(m, n) / (points[k] - poles(n));
+      }
+      const double error = std::abs(value - responses(k, m));
+      squaredError += error * error;
+      squaredValue += std::norm(responses(k, m));
+      result.maxError = std::max(result.maxError, error);
+    }
+  }
+  result.rmsError = std::sqrt(squaredError / double(K * M));
+  result.relativeRmsError =
+      squaredValue > 0.0 ? std::sqrt(squaredError / squaredValue) : result.rmsError;
+  return result;
+}
+
+} // namespace ocira::core
@@ -29,11 +29,15 @@
 
 #include "bus.hpp"
 #include "component.hpp"
+#include "connection_manager.hpp"
+#include <cstdint>
 #include <gtest/gtest.h>
 #include <memory>
+#include <vector>
 
 using namespace ocira::core;
 using namespace ocira::core::components;
+using namespace ocira::core::managers;
 
 /// @brief Test Bus class constructor.
 TEST(bus, constructor_works) {
@@ -164,4 +168,62 @@ TEST(bus, get_neighbor_buses) {
   // Validate results.
   EXPECT_FALSE(neigbors.empty());
   EXPECT_EQ(neigbors.at(0).lock()->getId(), 2);
-}
\ No newline at end of file
+}
+
+/// @brief Test that neighbor buses are visited once, by dense index, and the bus itself is skipped.
+TEST(bus, for_each_neighbor_bus) {
+  // Create buses with sparse identifiers and components.
+  std::shared_ptr<Bus> bus1 = std::make_shared<Bus>(10);
+  std::shared_ptr<Bus> bus2 = std::make_shared<Bus>(4000000000u);
+  std::shared_ptr<Bus> bus3 = std::make_shared<Bus>(7);
+  std::shared_ptr<Component> component1 = std::make_shared<Component>(1);
+  std::shared_ptr<Component> component2 = std::make_shared<Component>(2);
+  std::shared_ptr<Component> component3 = std::make_shared<Component>(3);
+  // Connect two parallel components between bus1 and bus2 and one between bus1 and bus3.
+  ConnectionManager::connectBusAndComponent(bus1, component1, TerminalRole::POSITIVE);
+  ConnectionManager::connectBusAndComponent(bus2, component1, TerminalRole::NEGATIVE);
+  ConnectionManager::connectBusAndComponent(bus1, component2, TerminalRole::POSITIVE);
+  ConnectionManager::connectBusAndComponent(bus2, component2, TerminalRole::NEGATIVE);
+  ConnectionManager::connectBusAndComponent(bus1, component3, TerminalRole::POSITIVE);
+  ConnectionManager::connectBusAndComponent(bus3, component3, TerminalRole::NEGATIVE);
+  // Index the buses densely and visit the neighbors of bus1 twice with the same scratch space.
+  auto indexOf = [](const Bus &bus) -> uint32_t {
+    return bus.getId() == 10 ? 0 : bus.getId() == 7 ? 2 : 1;
+  };
+  NeighborScratch scratch(3);
+  std::vector<uint32_t> first;
+  std::vector<uint32_t> second;
+  bus1->forEachNeighborBus(scratch, indexOf,
+                           [&](const std::shared_ptr<Bus> &, uint32_t index) {
+                             first.push_back(index);
+                           });
+  bus1->forEachNeighborBus(scratch, indexOf,
+                           [&](const std::shared_ptr<Bus> &, uint32_t index) {
+                             second.push_back(index);
+                           });
+  // Skip component3 and leave bus2 out.
+  std::vector<uint32_t> filtered;
+  bus1->forEachNeighborBus(
+      scratch, [](const Component &component) { return component.getId() != 3; },
+      [](const Bus &bus) { return bus.getId() == 10 ? 0u : NeighborScratch::NO_INDEX; },
+      [&](const std::shared_ptr<Bus> &, uint32_t index) { filtered.push_back(index); });
+  // Validate results.
+  EXPECT_EQ(first, (std::vector<uint32_t>{1, 2}));
+  EXPECT_EQ(second, first);
+  EXPECT_TRUE(filtered.empty());
+}
+
+/// @brief Test that the scratch space forgets its marks when a new epoch starts.
+TEST(bus, neighbor_scratch_epochs) {
+  // Create scratch space.
+  NeighborScratch scratch(2);
+  // Mark indices in the first epoch.
+  scratch.nextEpoch();
+  EXPECT_TRUE(scratch.mark(0));
+  EXPECT_FALSE(scratch.mark(0));
+  EXPECT_TRUE(scratch.mark(5));
+  // Start a new epoch and mark again.
+  scratch.nextEpoch();
+  EXPECT_TRUE(scratch.mark(0));
+  EXPECT_TRUE(scratch.mark(5));
+}
@@ -0,0 +1,71 @@
+//==============================================================================
+// File:        test_diode.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for Diode class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover Diode class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=diode.*
+//==============================================================================
+
+#include "diode.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+
+/// @brief Test Diode class constructor.
+TEST(diode, constructor_works) {
+  // Create new Diode object.
+  Diode diode(1, 1e-14f);
+  // Expect equality.
+  EXPECT_EQ(diode.getId(), 1);
+  EXPECT_EQ(diode.getComponentType(), ComponentType::DIODE);
+  EXPECT_FLOAT_EQ(diode.getSaturationCurrent(), 1e-14f);
+  EXPECT_FLOAT_EQ(diode.getEmissionCoefficient(), 1.0f);
+}
+
+/// @brief Test parameter setters and getters.
+TEST(diode, set_parameters) {
+  // Create new Diode object.
+  Diode diode(1, 1e-14f);
+  // Set new parameters.
+  diode.setSaturationCurrent(2e-12f);
+  diode.setEmissionCoefficient(1.8f);
+  // Expect equality.
+  EXPECT_FLOAT_EQ(diode.getSaturationCurrent(), 2e-12f);
+  EXPECT_FLOAT_EQ(diode.getEmissionCoefficient(), 1.8f);
+}
+
+/// @brief Test the current and conductance of the exponential model.
+TEST(diode, current_and_conductance) {
+  // Create new Diode object with n = 2.
+  Diode diode(1, 1e-12f, 2.0f);
+  const double thermalVoltage = 2.0 * Diode::THERMAL_VOLTAGE;
+  // Expect equality.
+  EXPECT_DOUBLE_EQ(diode.getCurrent(0.0), 0.0);
+  EXPECT_NEAR(diode.getCurrent(-5.0), -1e-12, 1e-18);
+  EXPECT_NEAR(diode.getCurrent(0.6) / (1e-12 * std::expm1(0.6 / thermalVoltage)), 1.0, 1e-6);
+  EXPECT_NEAR(diode.getConductance(0.6) * thermalVoltage / (diode.getCurrent(0.6) + 1e-12), 1.0,
+              1e-6);
+}
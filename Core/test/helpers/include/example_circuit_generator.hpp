@@ -26,6 +26,7 @@
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
 // - 2025-09-01 Martin Vidjeskog: Use ConnectionManager when building circuits.
+// - 2026-10-19 Martin Vidjeskog: Add divider and diode circuits.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -35,6 +36,7 @@
 #ifndef OCIRA_CORE_TEST_HELPERS_EXAMPLE_CIRCUIT_GENERATOR_HPP
 #define OCIRA_CORE_TEST_HELPERS_EXAMPLE_CIRCUIT_GENERATOR_HPP
 
+#include "circuit_enums.hpp"
 #include <memory>
 
 namespace ocira::core {
@@ -80,6 +82,28 @@ public:
   /// Useful for basic validation and simulation tests.
   /// @return Shared pointer to the generated Circuit instance.
   static std::shared_ptr<ocira::core::Circuit> getExampleCircuit3();
+
+  /// @brief Generates a voltage divider.
+  /// The circuit contains:
+  /// - A 10 V DC voltage source (ID 2) from ground to bus 1
+  /// - Two 1 kohm resistors (IDs 3 and 4) from bus 1 to bus 2 and from bus 2 to ground
+  /// - Optionally a 1 mA DC current source (ID 5) from ground into bus 2
+  /// Bus 2 is at 5 V, plus 0.5 V with the current source.
+  /// @param mode Simulation mode of the circuit.
+  /// @param hasCurrentSource Whether to add the current source.
+  /// @return Shared pointer to the generated Circuit instance.
+  static std::shared_ptr<ocira::core::Circuit>
+  getDividerCircuit(SimulationMode mode = SimulationMode::DC, bool hasCurrentSource = false);
+
+  /// @brief Generates a forward biased diode circuit.
+  /// The circuit contains:
+  /// - A 5 V DC voltage source (ID 2) from ground to bus 1
+  /// - A 1 kohm resistor (ID 3) from bus 1 to bus 2
+  /// - A diode (ID 4) with 1e-14 A saturation current from bus 2 (anode) to ground
+  /// @param mode Simulation mode of the circuit.
+  /// @return Shared pointer to the generated Circuit instance.
+  static std::shared_ptr<ocira::core::Circuit>
+  getDiodeCircuit(SimulationMode mode = SimulationMode::DC);
 };
 } // namespace ocira::core::test::helpers
 
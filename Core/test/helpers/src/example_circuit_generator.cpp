@@ -26,6 +26,7 @@
 // Revision History:
 // - 2025-08-26 Martin Vidjeskog: Initial creation
 // - 2025-09-01 Martin Vidjeskog: Use ConnectionManager when building circuits.
+// - 2026-10-19 Martin Vidjeskog: Add divider and diode circuits.
 // - [YYYY-MM-DD] [Contributor]: [Description of change]
 //==============================================================================
 // Notes:
@@ -37,6 +38,7 @@
 #include "bus.hpp"
 #include "capacitor.hpp"
 #include "circuit.hpp"
+#include "circuit_builder.hpp"
 #include "component.hpp"
 #include "connection_manager.hpp"
 #include "dc_current_source.hpp"
@@ -241,4 +243,32 @@ std::shared_ptr<Circuit> ExampleCircuitGenerator::getExampleCircuit3() {
   return circuit;
 }
 
+std::shared_ptr<Circuit> ExampleCircuitGenerator::getDividerCircuit(SimulationMode mode,
+                                                                   bool hasCurrentSource) {
+  CircuitBuilder builder(mode);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 4, 1000, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  if (hasCurrentSource) {
+    builder.addComponent({ComponentType::DC_CURRENT_SOURCE, 5, 1e-3f, 0, 2,
+                          TerminalRole::NEGATIVE, TerminalRole::POSITIVE});
+  }
+  return builder.build();
+}
+
+std::shared_ptr<Circuit> ExampleCircuitGenerator::getDiodeCircuit(SimulationMode mode) {
+  CircuitBuilder builder(mode);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 5, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::DIODE, 4, 1e-14f, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  return builder.build();
+}
 } // namespace ocira::core::test::helpers
\ No newline at end of file
@@ -0,0 +1,184 @@
+//==============================================================================
+// File:        test_branch_calculator.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for BranchCalculator class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover BranchCalculator class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=branch_calculator.*
+//==============================================================================
+
+#include "branch_calculator.hpp"
+#include "bus.hpp"
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_calculator.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_transformer.hpp"
+#include "connection_manager.hpp"
+#include "resistor.hpp"
+#include "subcircuit.hpp"
+#include <armadillo>
+#include <complex>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::managers;
+
+namespace {
+
+/// @brief Solves a transformed circuit.
+arma::cx_vec solve(const CircuitTransformer &transformer) {
+  return *CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                           transformer.getCurrentVector());
+}
+
+} // namespace
+
+/// @brief Test the quantities of a DC voltage divider.
+TEST(branch_calculator, dc_divider) {
+  // 10 V across two 1 kohm resistors.
+  CircuitBuilder builder;
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 4, 1000, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  CircuitTransformer transformer(builder.build());
+  BranchCalculator calculator(transformer);
+  BranchQuantities result = calculator.compute(solve(transformer));
+  // Verify results. Ground is not reported.
+  ASSERT_EQ(result.componentIds, (std::vector<ComponentId>{2, 3, 4}));
+  EXPECT_NEAR(result.voltages(0).real(), -10.0, 1e-9);
+  // The source current flows from its negative to its positive terminal, so it absorbs a
+  // negative power. Conductances are single precision.
+  EXPECT_NEAR(result.currents(0).real(), 5e-3, 1e-9);
+  EXPECT_NEAR(result.powers(0).real(), -50e-3, 1e-8);
+  for (arma::uword k = 1; k < 3; k++) {
+    EXPECT_NEAR(result.voltages(k).real(), 5.0, 1e-9);
+    EXPECT_NEAR(result.currents(k).real(), 5e-3, 1e-9);
+    EXPECT_NEAR(result.powers(k).real(), 25e-3, 1e-8);
+  }
+  EXPECT_NEAR(result.sourcePower.real(), 50e-3, 1e-8);
+  EXPECT_NEAR(std::abs(result.sourcePower - result.loadPower), 0.0, 1e-12);
+}
+
+/// @brief Test a current source whose terminals are given in reverse order.
+TEST(branch_calculator, dc_current_source) {
+  // 2 mA into 1 kohm, the source is connected positive terminal first.
+  CircuitBuilder builder;
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_CURRENT_SOURCE, 2, 2e-3f, 1, 0, TerminalRole::POSITIVE,
+       TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  CircuitTransformer transformer(builder.build());
+  BranchQuantities result = BranchCalculator(transformer).compute(solve(transformer));
+  // Verify results. The source current flows from bus 1 back into it.
+  EXPECT_NEAR(result.voltages(0).real(), 2.0, 1e-6);
+  EXPECT_NEAR(result.currents(0).real(), -2e-3, 1e-9);
+  EXPECT_NEAR(result.currents(1).real(), 2e-3, 1e-9);
+  EXPECT_NEAR(result.sourcePower.real(), 4e-3, 1e-9);
+  EXPECT_NEAR(result.loadPower.real(), 4e-3, 1e-9);
+}
+
+/// @brief Test that the power of an AC circuit balances and that reactances absorb no real
+/// power.
+TEST(branch_calculator, ac_power_balance) {
+  // Source -> R -> C to ground -> L -> R to ground, with a current source at the load.
+  CircuitBuilder builder(SimulationMode::AC);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::AC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE, 20},
+      {ComponentType::RESISTOR, 3, 100, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::CAPACITOR, 4, 1e-6f, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::INDUCTOR, 5, 1e-2f, 2, 3, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 6, 50, 3, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::AC_CURRENT_SOURCE, 7, 0.02f, 0, 3, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE, -45},
+  });
+  std::shared_ptr<Circuit> circuit = builder.build();
+  circuit->setFrequency(1000.0f);
+  CircuitTransformer transformer(circuit);
+  BranchQuantities result = BranchCalculator(transformer).compute(solve(transformer));
+  // Verify results.
+  ASSERT_EQ(result.componentIds.size(), 6);
+  EXPECT_NEAR(std::abs(result.sourcePower - result.loadPower), 0.0, 1e-6);
+  EXPECT_GT(result.loadPower.real(), 0.0);
+  EXPECT_NEAR(result.powers(2).real(), 0.0, 1e-6);
+  EXPECT_NEAR(result.powers(3).real(), 0.0, 1e-6);
+  EXPECT_LT(result.powers(2).imag(), 0.0);
+  EXPECT_GT(result.powers(3).imag(), 0.0);
+  // Resistors absorb |I|^2 R / 2 with peak phasors.
+  EXPECT_NEAR(result.powers(1).real(), 0.5 * std::norm(result.currents(1)) * 100.0, 1e-7);
+}
+
+/// @brief Test that component overrides of the snapshot are honoured.
+TEST(branch_calculator, snapshot_override) {
+  // A single resistor, changed from 1 kohm to 500 ohm.
+  CircuitBuilder builder;
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  CircuitTransformer transformer(CircuitSnapshot(builder.build()).withComponentValue(3, 500.0f));
+  BranchCalculator calculator(transformer);
+  BranchQuantities result = calculator.compute(solve(transformer));
+  // Verify results.
+  EXPECT_NEAR(result.currents(1).real(), 20e-3, 1e-9);
+  EXPECT_NEAR(std::abs(result.sourcePower - result.loadPower), 0.0, 1e-9);
+  EXPECT_THROW(calculator.compute(arma::cx_vec(5, arma::fill::zeros)), std::runtime_error);
+}
+
+/// @brief Test that circuits with subcircuit instances are rejected.
+TEST(branch_calculator, rejects_subcircuit_instances) {
+  // A 1 kohm resistor across the source, placed inside an instance.
+  auto in = std::make_shared<Bus>(1);
+  auto out = std::make_shared<Bus>(2);
+  auto resistor = std::make_shared<Resistor>(1, 1000);
+  ConnectionManager::connectBusAndComponent(in, resistor, TerminalRole::NEGATIVE);
+  ConnectionManager::connectBusAndComponent(out, resistor, TerminalRole::POSITIVE);
+  auto cell = std::make_shared<const SubcircuitDefinition>(
+      std::vector<std::shared_ptr<Bus>>{in, out}, std::vector<std::shared_ptr<Component>>{resistor},
+      std::vector<BusId>{1, 2});
+  CircuitBuilder builder;
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+  });
+  auto circuit = builder.build();
+  circuit->setSubcircuitInstances(
+      {std::make_shared<const SubcircuitInstance>(1, cell, std::vector<BusId>{1, 0})});
+  CircuitTransformer transformer(circuit);
+  // Verify results. The resistor would be missing from the load power.
+  EXPECT_THROW(BranchCalculator calculator(transformer), std::runtime_error);
+}
@@ -0,0 +1,116 @@
+//==============================================================================
+// File:        test_circuit_arena.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for CircuitArena class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover CircuitArena and ArenaAllocator classes.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=circuit_arena.*
+//==============================================================================
+
+#include "bus.hpp"
+#include "circuit.hpp"
+#include "circuit_arena.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_validator.hpp"
+#include "circuit_structs.hpp"
+#include "component.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+
+/// @brief Test that allocations respect the requested alignment.
+TEST(circuit_arena, allocations_are_aligned) {
+  // Create arena.
+  CircuitArena arena(256);
+  // Allocate blocks with different alignments.
+  void *first = arena.allocate(3, 1);
+  void *second = arena.allocate(8, 16);
+  void *third = arena.allocate(4, 4);
+  // Verify results.
+  EXPECT_NE(first, second);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % 16, 0);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(third) % 4, 0);
+  EXPECT_EQ(arena.getBytesAllocated(), 15);
+  EXPECT_EQ(arena.getNumberOfSlabs(), 1);
+}
+
+/// @brief Test that a new slab is started when the current one is full.
+TEST(circuit_arena, new_slab_when_full) {
+  // Create arena with small slabs.
+  CircuitArena arena(64);
+  // Fill the first slab and overflow it.
+  arena.allocate(48, 8);
+  arena.allocate(48, 8);
+  // Allocate a block larger than the slab size.
+  void *large = arena.allocate(1000, 8);
+  // Verify results.
+  EXPECT_NE(large, nullptr);
+  EXPECT_EQ(arena.getNumberOfSlabs(), 3);
+}
+
+/// @brief Test that the builder places circuit elements in the arena.
+TEST(circuit_arena, builder_uses_arena) {
+  // Build circuit in arena mode.
+  CircuitBuilder builder(SimulationMode::DC, AllocationMode::ARENA);
+  builder.addComponent(
+      {ComponentType::GROUND, 1, 0, 1, 1, TerminalRole::NEGATIVE, TerminalRole::NEGATIVE});
+  builder.addComponent({ComponentType::DC_CURRENT_SOURCE, 2, 1, 1, 2, TerminalRole::NEGATIVE,
+                        TerminalRole::POSITIVE});
+  builder.addComponent(
+      {ComponentType::RESISTOR, 3, 200, 2, 1, TerminalRole::NEGATIVE, TerminalRole::POSITIVE});
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Verify results.
+  ASSERT_NE(circuit->getArena(), nullptr);
+  EXPECT_EQ(circuit->getArena()->getNumberOfSlabs(), 1);
+  EXPECT_GT(circuit->getArena()->getBytesAllocated(), 0);
+  EXPECT_TRUE(CircuitValidator::isValidCircuit(*circuit).isValid);
+}
+
+/// @brief Test that heap allocation mode does not create an arena.
+TEST(circuit_arena, heap_mode_has_no_arena) {
+  // Build circuit in heap mode.
+  CircuitBuilder builder;
+  builder.addBus(1);
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Verify results.
+  EXPECT_EQ(circuit->getArena(), nullptr);
+}
+
+/// @brief Test that an element stays valid after its circuit has been destroyed.
+TEST(circuit_arena, element_outlives_circuit) {
+  // Build circuit in arena mode.
+  CircuitBuilder builder(SimulationMode::DC, AllocationMode::ARENA);
+  builder.addComponent(
+      {ComponentType::RESISTOR, 7, 10, 1, 2, TerminalRole::NEGATIVE, TerminalRole::POSITIVE});
+  std::shared_ptr<Circuit> circuit = builder.build();
+  std::shared_ptr<Bus> bus = circuit->getBuses().at(1);
+  // Destroy the circuit.
+  circuit.reset();
+  // Verify that the bus and its component are still usable.
+  EXPECT_EQ(bus->getId(), 2);
+  ASSERT_EQ(bus->getNumberOfComponents(), 1);
+  EXPECT_EQ(bus->getComponents().at(0)->getId(), 7);
+}
@@ -0,0 +1,183 @@
+//==============================================================================
+// File:        test_circuit_builder.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for CircuitBuilder class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover CircuitBuilder class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=circuit_builder.*
+//==============================================================================
+
+#include "bus.hpp"
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_calculator.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include "component.hpp"
+#include "resistor.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+
+/// @brief Test building example circuit 2 from an edge list.
+TEST(circuit_builder, example_circuit_2) {
+  // Describe example circuit 2 as an edge list.
+  CircuitBuilder builder;
+  builder.reserve(5, 11);
+  for (BusId id = 0; id < 5; id++) {
+    builder.addBus(id);
+  }
+  builder.addComponents({
+      {ComponentType::GROUND, 0, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 1, 5, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::DC_CURRENT_SOURCE, 9, 1, 0, 4, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::DC_CURRENT_SOURCE, 10, 2, 0, 2, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 2, 100, 1, 2, TerminalRole::NEGATIVE, TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 100, 2, 0, TerminalRole::NEGATIVE, TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 4, 9, 2, 3, TerminalRole::NEGATIVE, TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 5, 1, 3, 4, TerminalRole::NEGATIVE, TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 6, 10, 2, 4, TerminalRole::NEGATIVE, TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 7, 1, 4, 0, TerminalRole::NEGATIVE, TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 8, 50, 0, 2, TerminalRole::NEGATIVE, TerminalRole::POSITIVE},
+  });
+  // Build the circuit.
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Verify the structure.
+  EXPECT_EQ(circuit->getBuses().size(), 5);
+  EXPECT_EQ(circuit->getComponents().size(), 11);
+  EXPECT_EQ(circuit->getBuses().at(2)->getNumberOfComponents(), 6);
+  EXPECT_TRUE(CircuitValidator::isValidCircuit(*circuit).isValid);
+  // Verify that the circuit solves to the same voltages as the hand-built one.
+  CircuitTransformer transformer(circuit);
+  std::shared_ptr<arma::cx_vec> solution = CircuitCalculator::solveVoltages(
+      transformer.getAdmittanceMatrix(), transformer.getCurrentVector());
+  EXPECT_FLOAT_EQ((*solution)(0).real(), 5.0f);
+  EXPECT_FLOAT_EQ((*solution)(1).real(), 10.725806f);
+  EXPECT_FLOAT_EQ((*solution)(2).real(), 3.4314516f);
+  EXPECT_FLOAT_EQ((*solution)(3).real(), 2.6209679f);
+}
+
+/// @brief Test that buses referenced only by components are created in order of appearance.
+TEST(circuit_builder, buses_are_created_from_components) {
+  // Describe a circuit without adding buses explicitly.
+  CircuitBuilder builder;
+  builder.addComponent(
+      {ComponentType::RESISTOR, 1, 10, 7, 3, TerminalRole::POSITIVE, TerminalRole::NEGATIVE});
+  builder.addComponent(
+      {ComponentType::GROUND, 2, 0, 3, 3, TerminalRole::NEGATIVE, TerminalRole::NEGATIVE});
+  // Build the circuit.
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Verify results.
+  ASSERT_EQ(circuit->getBuses().size(), 2);
+  EXPECT_EQ(circuit->getBuses().at(0)->getId(), 7);
+  EXPECT_EQ(circuit->getBuses().at(1)->getId(), 3);
+  auto resistor = std::dynamic_pointer_cast<Resistor>(circuit->getComponents().at(0));
+  ASSERT_TRUE(resistor);
+  EXPECT_FLOAT_EQ(resistor->getResistance(), 10.0f);
+  EXPECT_EQ(resistor->getConnections().at(0).role, TerminalRole::POSITIVE);
+  EXPECT_EQ(resistor->getConnections().at(1).bus.lock()->getId(), 3);
+  EXPECT_EQ(circuit->getComponents().at(1)->getConnections().size(), 1);
+  EXPECT_TRUE(circuit->getComponents().at(1)->isConnected());
+}
+
+/// @brief Test that an explicitly added bus without components is kept.
+TEST(circuit_builder, unconnected_bus_is_kept) {
+  // Describe a circuit with one unconnected bus.
+  CircuitBuilder builder;
+  builder.addBus(1);
+  builder.addBus(1);
+  // Build the circuit.
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Verify results.
+  ASSERT_EQ(circuit->getBuses().size(), 1);
+  EXPECT_FALSE(circuit->getBuses().at(0)->isConnected());
+}
+
+/// @brief Test that a component with both terminals on the same bus is only connected once.
+TEST(circuit_builder, component_connected_to_same_bus_twice) {
+  // Describe a shorted resistor.
+  CircuitBuilder builder;
+  builder.addComponent(
+      {ComponentType::RESISTOR, 1, 10, 1, 1, TerminalRole::POSITIVE, TerminalRole::NEGATIVE});
+  // Build the circuit.
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Verify results.
+  EXPECT_EQ(circuit->getBuses().at(0)->getNumberOfComponents(), 1);
+  EXPECT_FALSE(circuit->getComponents().at(0)->isConnected());
+}
+
+/// @brief Test that the builder is empty after building and keeps the simulation mode.
+TEST(circuit_builder, builder_can_be_reused) {
+  // Build one circuit.
+  CircuitBuilder builder(SimulationMode::AC);
+  builder.addComponent({ComponentType::AC_VOLTAGE_SOURCE, 1, 1, 1, 2, TerminalRole::NEGATIVE,
+                        TerminalRole::POSITIVE, 90});
+  std::shared_ptr<Circuit> first = builder.build();
+  // Build again without adding anything.
+  std::shared_ptr<Circuit> second = builder.build();
+  // Verify results.
+  EXPECT_EQ(first->getSimulationMode(), SimulationMode::AC);
+  EXPECT_EQ(first->getComponents().size(), 1);
+  EXPECT_TRUE(second->getComponents().empty());
+  EXPECT_TRUE(second->getBuses().empty());
+}
+
+/// @brief Test that an unsupported component type is rejected.
+TEST(circuit_builder, unsupported_component_type_throws) {
+  // Describe an undefined component.
+  CircuitBuilder builder;
+  builder.addComponent(
+      {ComponentType::UNDEFINED, 1, 0, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE});
+  // Verify that building fails.
+  EXPECT_THROW(builder.build(), std::runtime_error);
+}
+
+/// @brief Test building a large resistor ladder.
+TEST(circuit_builder, large_ladder) {
+  // Describe a ladder with a series and a shunt resistor per stage.
+  const uint32_t stages = 100000;
+  CircuitBuilder builder;
+  builder.reserve(stages + 1, 2 * stages + 2);
+  builder.addComponent(
+      {ComponentType::GROUND, 0, 0, 0, 0, TerminalRole::NEGATIVE, TerminalRole::NEGATIVE});
+  builder.addComponent({ComponentType::DC_VOLTAGE_SOURCE, 1, 1, 0, 1, TerminalRole::NEGATIVE,
+                        TerminalRole::POSITIVE});
+  for (uint32_t k = 1; k < stages; k++) {
+    builder.addComponent({ComponentType::RESISTOR, 2 * k, 1, k, k + 1, TerminalRole::POSITIVE,
+                          TerminalRole::NEGATIVE});
+    builder.addComponent({ComponentType::RESISTOR, 2 * k + 1, 1, k + 1, 0,
+                          TerminalRole::POSITIVE, TerminalRole::NEGATIVE});
+  }
+  // Build the circuit.
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Verify results.
+  EXPECT_EQ(circuit->getBuses().size(), stages + 1);
+  EXPECT_EQ(circuit->getComponents().size(), 2 * stages);
+  EXPECT_EQ(circuit->getBuses().at(0)->getNumberOfComponents(), stages + 1);
+}
@@ -0,0 +1,103 @@
+//==============================================================================
+// File:        test_circuit_factorization.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for CircuitFactorization class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover CircuitFactorization class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=circuit_factorization.*
+//==============================================================================
+
+#include "circuit_calculator.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_transformer.hpp"
+#include "example_circuit_generator.hpp"
+#include <armadillo>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using namespace ocira::core;
+using namespace ocira::core::test::helpers;
+
+/// @brief Test that a factorization solves like CircuitCalculator.
+TEST(circuit_factorization, solve_matches_calculator) {
+  // Transform example circuit 2.
+  CircuitTransformer transformer(ExampleCircuitGenerator::getExampleCircuit2());
+  // Solve in both ways.
+  CircuitFactorization factorization(*transformer.getAdmittanceMatrix());
+  arma::cx_vec actual = factorization.solve(*transformer.getCurrentVector());
+  auto expected = CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                                   transformer.getCurrentVector());
+  // Verify results.
+  ASSERT_EQ(actual.n_elem, expected->n_elem);
+  EXPECT_EQ(factorization.getSize(), expected->n_elem);
+  for (arma::uword k = 0; k < actual.n_elem; k++) {
+    EXPECT_NEAR(std::abs(actual(k) - (*expected)(k)), 0.0, 1e-9);
+  }
+}
+
+/// @brief Test solving several right-hand sides at once.
+TEST(circuit_factorization, solve_multiple_right_hand_sides) {
+  // Transform example circuit 3.
+  CircuitTransformer transformer(ExampleCircuitGenerator::getExampleCircuit3());
+  const arma::cx_mat &Y = *transformer.getAdmittanceMatrix();
+  CircuitFactorization factorization(Y);
+  // Solve for the identity, which gives the inverse.
+  arma::cx_mat I(Y.n_rows, Y.n_cols, arma::fill::eye);
+  arma::cx_mat X = factorization.solve(I);
+  arma::cx_mat product = Y * X;
+  // Verify results.
+  for (arma::uword k = 0; k < product.n_elem; k++) {
+    EXPECT_NEAR(std::abs(product(k) - I(k)), 0.0, 1e-9);
+  }
+}
+
+/// @brief Test solving with the transposed matrix.
+TEST(circuit_factorization, solve_transposed) {
+  // Create an unsymmetric matrix.
+  arma::cx_mat Y(3, 3, arma::fill::zeros);
+  Y(0, 0) = 1.0;
+  Y(0, 2) = 2.0;
+  Y(1, 0) = 4.0;
+  Y(1, 1) = std::complex<double>(0.0, 1.0);
+  Y(2, 1) = 3.0;
+  Y(2, 2) = 1.0;
+  arma::cx_vec b(3, arma::fill::ones);
+  // Solve Y^T x = b.
+  CircuitFactorization factorization(Y);
+  arma::cx_vec x = factorization.solveTransposed(b);
+  arma::cx_vec residual = Y.st() * x - b;
+  // Verify results.
+  for (arma::uword k = 0; k < residual.n_elem; k++) {
+    EXPECT_NEAR(std::abs(residual(k)), 0.0, 1e-12);
+  }
+}
+
+/// @brief Test that a singular matrix is rejected.
+TEST(circuit_factorization, singular_matrix) {
+  // Create a singular matrix.
+  arma::cx_mat Y(2, 2, arma::fill::ones);
+  // Verify results.
+  EXPECT_THROW(CircuitFactorization factorization(Y), std::runtime_error);
+  EXPECT_THROW(CircuitFactorization factorization(arma::cx_mat(2, 3, arma::fill::zeros)),
+               std::runtime_error);
+}
@@ -0,0 +1,108 @@
+//==============================================================================
+// File:        test_circuit_fingerprint.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for CircuitFingerprinter class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover CircuitFingerprinter class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=circuit_fingerprint.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_fingerprint.hpp"
+#include "component.hpp"
+#include "connection_manager.hpp"
+#include "dc_current_source.hpp"
+#include "example_circuit_generator.hpp"
+#include "resistor.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::managers;
+using namespace ocira::core::test::helpers;
+
+/// @brief Test that the same circuit gets the same fingerprint.
+TEST(circuit_fingerprint, identical_circuits) {
+  // Create the same circuit twice.
+  auto first = ExampleCircuitGenerator::getExampleCircuit2();
+  auto second = ExampleCircuitGenerator::getExampleCircuit2();
+  // Verify results.
+  EXPECT_EQ(CircuitFingerprinter::compute(*first), CircuitFingerprinter::compute(*second));
+  EXPECT_NE(CircuitFingerprinter::compute(*first),
+            CircuitFingerprinter::compute(*ExampleCircuitGenerator::getExampleCircuit1()));
+}
+
+/// @brief Test that source values only change the full hash.
+TEST(circuit_fingerprint, source_value_changes_full_hash) {
+  // Create circuit 1 and change its current source.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  CircuitFingerprint before = CircuitFingerprinter::compute(*circuit);
+  std::static_pointer_cast<DCCurrentSource>(circuit->getComponents().at(0))->setAmps(2.0f);
+  CircuitFingerprint after = CircuitFingerprinter::compute(*circuit);
+  // Verify results.
+  EXPECT_EQ(before.topology, after.topology);
+  EXPECT_EQ(before.admittance, after.admittance);
+  EXPECT_NE(before.full, after.full);
+}
+
+/// @brief Test that passive values change the admittance and full hashes.
+TEST(circuit_fingerprint, passive_value_changes_admittance_hash) {
+  // Create circuit 1 and change its resistor.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  CircuitFingerprint before = CircuitFingerprinter::compute(*circuit);
+  std::static_pointer_cast<Resistor>(circuit->getComponents().at(1))->setResistance(100.0f);
+  CircuitFingerprint after = CircuitFingerprinter::compute(*circuit);
+  // Verify results.
+  EXPECT_EQ(before.topology, after.topology);
+  EXPECT_NE(before.admittance, after.admittance);
+  EXPECT_NE(before.full, after.full);
+}
+
+/// @brief Test that rewiring a component changes every hash.
+TEST(circuit_fingerprint, rewiring_changes_topology_hash) {
+  // Create circuit 1 and flip the role of the resistor's terminal at bus 1.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  CircuitFingerprint before = CircuitFingerprinter::compute(*circuit);
+  auto resistor = circuit->getComponents().at(1);
+  auto bus1 = circuit->getBuses().at(0);
+  ConnectionManager::disconnectBusAndComponent(bus1, resistor);
+  ConnectionManager::connectBusAndComponent(bus1, resistor, TerminalRole::NEGATIVE);
+  CircuitFingerprint after = CircuitFingerprinter::compute(*circuit);
+  // Verify results.
+  EXPECT_NE(before.topology, after.topology);
+  EXPECT_NE(before.admittance, after.admittance);
+  EXPECT_NE(before.full, after.full);
+}
+
+/// @brief Test that the frequency is part of the admittance hash.
+TEST(circuit_fingerprint, frequency_changes_admittance_hash) {
+  // Create circuit 3 and change its frequency.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  CircuitFingerprint before = CircuitFingerprinter::compute(*circuit);
+  circuit->setFrequency(60.0f);
+  CircuitFingerprint after = CircuitFingerprinter::compute(*circuit);
+  // Verify results.
+  EXPECT_EQ(before.topology, after.topology);
+  EXPECT_NE(before.admittance, after.admittance);
+}
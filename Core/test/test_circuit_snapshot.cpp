@@ -0,0 +1,182 @@
+//==============================================================================
+// File:        test_circuit_snapshot.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for CircuitSnapshot class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover CircuitSnapshot class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=circuit_snapshot.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_calculator.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_transformer.hpp"
+#include "example_circuit_generator.hpp"
+#include <cmath>
+#include <complex>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::test::helpers;
+
+/// @brief Test that a snapshot without overrides transforms like the circuit itself.
+TEST(circuit_snapshot, base_snapshot_matches_circuit) {
+  // Get example circuit and its snapshot.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  CircuitSnapshot snapshot(circuit);
+  // Transform both.
+  CircuitTransformer fromCircuit(circuit);
+  CircuitTransformer fromSnapshot(snapshot);
+  // Verify results.
+  EXPECT_EQ(snapshot.getNumberOfOverrides(), 0);
+  EXPECT_EQ(snapshot.getSimulationMode(), SimulationMode::AC);
+  EXPECT_FLOAT_EQ(snapshot.getFrequency(), 50.0f);
+  const arma::cx_mat &expected = *fromCircuit.getAdmittanceMatrix();
+  const arma::cx_mat &actual = *fromSnapshot.getAdmittanceMatrix();
+  for (arma::uword k = 0; k < expected.n_elem; k++) {
+    EXPECT_EQ(actual(k), expected(k));
+  }
+}
+
+/// @brief Test that a variant overrides a component without touching the base snapshot.
+TEST(circuit_snapshot, variant_overrides_component) {
+  // Get example circuit 1 (1 A into a 200 ohm resistor).
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  CircuitSnapshot base(circuit);
+  // Derive a variant with a 100 ohm resistor and a 2 A source.
+  CircuitSnapshot variant = base.withComponentValue(2, 100).withComponentValue(1, 2);
+  // Solve both.
+  CircuitTransformer baseTransformer(base);
+  CircuitTransformer variantTransformer(variant);
+  auto baseSolution = CircuitCalculator::solveVoltages(baseTransformer.getAdmittanceMatrix(),
+                                                       baseTransformer.getCurrentVector());
+  auto variantSolution = CircuitCalculator::solveVoltages(
+      variantTransformer.getAdmittanceMatrix(), variantTransformer.getCurrentVector());
+  // Verify results.
+  EXPECT_EQ(base.getNumberOfOverrides(), 0);
+  EXPECT_EQ(variant.getNumberOfOverrides(), 2);
+  EXPECT_EQ(base.findOverride(2), nullptr);
+  ASSERT_NE(variant.findOverride(2), nullptr);
+  EXPECT_FLOAT_EQ(variant.findOverride(2)->value, 100.0f);
+  EXPECT_EQ(variant.getCircuit(), base.getCircuit());
+  EXPECT_FLOAT_EQ((*baseSolution)(0).real(), 200.0f);
+  EXPECT_FLOAT_EQ((*variantSolution)(0).real(), 200.0f);
+}
+
+/// @brief Test that overriding the same component twice keeps the latest value.
+TEST(circuit_snapshot, latest_override_wins) {
+  // Get example circuit 1.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  CircuitSnapshot base(circuit);
+  // Override the resistor twice.
+  CircuitSnapshot first = base.withComponentValue(2, 50);
+  CircuitSnapshot second = first.withComponentValue(2, 400);
+  // Solve the second variant.
+  CircuitTransformer transformer(second);
+  auto solution = CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                                   transformer.getCurrentVector());
+  // Verify results.
+  EXPECT_FLOAT_EQ(first.findOverride(2)->value, 50.0f);
+  EXPECT_EQ(second.getNumberOfOverrides(), 1);
+  EXPECT_FLOAT_EQ((*solution)(0).real(), 400.0f);
+}
+
+/// @brief Test that a long chain of variants keeps every override of every variant.
+TEST(circuit_snapshot, long_chain_of_variants) {
+  // Get example circuit 1.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  std::vector<CircuitSnapshot> variants = {CircuitSnapshot(circuit)};
+  // Override a different ID in every variant, and the resistor every tenth time.
+  for (ComponentId id = 100; id < 300; id++) {
+    variants.push_back(variants.back().withComponentValue(id, static_cast<float>(id)));
+    if (id % 10 == 0) {
+      variants.push_back(variants.back().withComponentValue(2, static_cast<float>(id)));
+    }
+  }
+  // Verify results.
+  const CircuitSnapshot &last = variants.back();
+  EXPECT_EQ(last.getNumberOfOverrides(), 201);
+  for (ComponentId id = 100; id < 300; id++) {
+    ASSERT_NE(last.findOverride(id), nullptr);
+    EXPECT_FLOAT_EQ(last.findOverride(id)->value, static_cast<float>(id));
+  }
+  EXPECT_FLOAT_EQ(last.findOverride(2)->value, 290.0f);
+  EXPECT_EQ(variants[50].findOverride(200), nullptr);
+  EXPECT_EQ(variants[0].getNumberOfOverrides(), 0);
+}
+
+/// @brief Test that an amplitude-only override keeps the phase of an AC source.
+TEST(circuit_snapshot, amplitude_override_keeps_phase) {
+  // 10 V at 30 degrees across a resistor.
+  CircuitBuilder builder(SimulationMode::AC);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::AC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE, 30},
+      {ComponentType::RESISTOR, 3, 100, 1, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  CircuitSnapshot base(builder.build());
+  // Override the amplitude, then the phase, then the amplitude again.
+  CircuitSnapshot first = base.withComponentValue(2, 20.0f);
+  CircuitSnapshot second = first.withComponentValue(2, 20.0f, 45.0f);
+  CircuitSnapshot third = second.withComponentValue(2, 5.0f);
+  // Verify results.
+  EXPECT_FLOAT_EQ(first.findOverride(2)->phase, 30.0f);
+  EXPECT_FLOAT_EQ(third.findOverride(2)->phase, 45.0f);
+  EXPECT_FLOAT_EQ(base.withComponentValue(3, 50.0f).findOverride(3)->phase, 0.0f);
+  CircuitTransformer transformer(first);
+  auto solution = CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                                   transformer.getCurrentVector());
+  EXPECT_NEAR(std::arg((*solution)(0)), std::acos(-1.0) / 6.0, 1e-6);
+  EXPECT_NEAR(std::abs((*solution)(0)), 20.0, 1e-5);
+}
+
+/// @brief Test that a frequency variant changes reactive admittances only.
+TEST(circuit_snapshot, frequency_variant) {
+  // Get example circuit 3.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  CircuitSnapshot base(circuit);
+  // Derive a variant at 100 Hz.
+  CircuitSnapshot variant = base.withFrequency(-100.0f);
+  // Transform both.
+  CircuitTransformer baseTransformer(base);
+  CircuitTransformer variantTransformer(variant);
+  // Verify results.
+  EXPECT_FLOAT_EQ(variant.getFrequency(), 100.0f);
+  EXPECT_FLOAT_EQ(circuit->getFrequency(), 50.0f);
+  EXPECT_NE((*baseTransformer.getAdmittanceMatrix())(1, 1),
+            (*variantTransformer.getAdmittanceMatrix())(1, 1));
+}
+
+/// @brief Test that a frequency variant of a DC circuit stays at zero frequency.
+TEST(circuit_snapshot, dc_frequency_variant_is_ignored) {
+  // Get example circuit 1.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  CircuitSnapshot variant = CircuitSnapshot(circuit).withFrequency(60.0f);
+  // Verify results.
+  EXPECT_FLOAT_EQ(variant.getFrequency(), 0.0f);
+}
@@ -32,6 +32,7 @@
 #include "example_circuit_generator.hpp"
 #include <gtest/gtest.h>
 #include <memory>
+#include <stdexcept>
 
 using namespace ocira::core;
 using namespace ocira::core::components;
@@ -133,4 +134,21 @@ TEST(circuit_transformer, example_circuit_3) {
 
   EXPECT_EQ(bNumberMap.size(), 4);
   EXPECT_EQ(bIdMap.size(), 4);
-}
\ No newline at end of file
+
+  EXPECT_EQ(circuitTransformer.getVoltageSourceRow(1), 3);
+  EXPECT_THROW(circuitTransformer.getVoltageSourceRow(4), std::runtime_error);
+}
+// Test that the shared numbering agrees with the transformer.
+TEST(circuit_transformer, number_circuit) {
+  // Get example circuit and number it.
+  const auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  MnaNumbering numbering = CircuitTransformer::numberCircuit(*circuit);
+  CircuitTransformer circuitTransformer(circuit);
+
+  // Verify results.
+  EXPECT_EQ(numbering.busIdMap, circuitTransformer.getBusIdMap());
+  EXPECT_EQ(numbering.busNumberMap, circuitTransformer.getBusNumberMap());
+  EXPECT_EQ(numbering.sizeG + numbering.sizeB, circuitTransformer.getAdmittanceMatrix()->n_rows);
+  ASSERT_EQ(numbering.voltageSourceRows.size(), 1);
+  EXPECT_EQ(numbering.voltageSourceRows.at(1), circuitTransformer.getVoltageSourceRow(1));
+}
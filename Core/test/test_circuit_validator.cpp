@@ -29,6 +29,7 @@
 
 #include "bus.hpp"
 #include "circuit.hpp"
+#include "circuit_builder.hpp"
 #include "circuit_structs.hpp"
 #include "circuit_validator.hpp"
 #include "component.hpp"
@@ -233,4 +234,184 @@ TEST(circuit_validator, circuit_not_fully_connected) {
         return error.code == ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED;
       });
   EXPECT_TRUE(it != result.errors.end());
-}
\ No newline at end of file
+}
+
+/// @brief Test validation for a long series chain that used to exhaust the call stack.
+TEST(circuit_validator, long_chain_is_fully_connected) {
+  // Build a chain of resistors with one ground.
+  const uint32_t length = 200000;
+  CircuitBuilder builder;
+  builder.reserve(length + 1, length + 1);
+  builder.addComponent(
+      {ComponentType::GROUND, 0, 0, 0, 0, TerminalRole::NEGATIVE, TerminalRole::NEGATIVE});
+  for (uint32_t k = 0; k < length; k++) {
+    builder.addComponent({ComponentType::RESISTOR, k + 1, 1, k, k + 1, TerminalRole::POSITIVE,
+                          TerminalRole::NEGATIVE});
+  }
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Validate the circuit.
+  ValidationResult result = CircuitValidator::isValidCircuit(*circuit);
+  // Verify results.
+  EXPECT_TRUE(result.isValid);
+  EXPECT_TRUE(result.errors.empty());
+}
+
+/// @brief Test that errors are reported in the order of the checks.
+TEST(circuit_validator, errors_keep_check_order) {
+  // Create circuit with a free bus, two unconnected components with the same ID and no ground.
+  Circuit circuit(SimulationMode::AC);
+  circuit.setBuses({std::make_shared<Bus>(1), std::make_shared<Bus>(2)});
+  circuit.setComponents(
+      {std::make_shared<DCCurrentSource>(1, 1.0f), std::make_shared<DCCurrentSource>(1, 1.0f)});
+  // Validate the circuit.
+  ValidationResult result = CircuitValidator::isValidCircuit(circuit);
+  // Verify results.
+  std::vector<ValidationErrorCode> expected = {
+      ValidationErrorCode::UNCONNECTED_BUS,
+      ValidationErrorCode::UNCONNECTED_BUS,
+      ValidationErrorCode::UNCONNECTED_COMPONENT,
+      ValidationErrorCode::UNCONNECTED_COMPONENT,
+      ValidationErrorCode::GROUND_COMPONENT_MISSING,
+      ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_AC_SIMULATION,
+      ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_AC_SIMULATION,
+      ValidationErrorCode::DUPLICATE_IDENTIFIER,
+      ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED,
+  };
+  EXPECT_FALSE(result.isValid);
+  ASSERT_EQ(result.errors.size(), expected.size());
+  for (size_t k = 0; k < expected.size(); k++) {
+    EXPECT_EQ(result.errors.at(k).code, expected.at(k));
+  }
+}
+
+/// @brief Test that parallel validation gives the same result as sequential validation.
+TEST(circuit_validator, parallel_matches_sequential) {
+  // Build a long AC chain with a few problems in it.
+  const uint32_t length = 50000;
+  CircuitBuilder builder(SimulationMode::AC);
+  builder.addComponent(
+      {ComponentType::GROUND, 0, 0, 0, 0, TerminalRole::NEGATIVE, TerminalRole::NEGATIVE});
+  for (uint32_t k = 0; k < length; k++) {
+    // Every 10000th element is a DC source, and one resistor ID is used twice.
+    ComponentType type =
+        k % 10000 == 5 ? ComponentType::DC_CURRENT_SOURCE : ComponentType::RESISTOR;
+    ComponentId id = k == 30000 ? 20000 : k + 1;
+    builder.addComponent({type, id, 1, k, k + 1, TerminalRole::NEGATIVE, TerminalRole::POSITIVE});
+  }
+  builder.addBus(length + 10);
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Validate the circuit in both ways.
+  ValidationResult sequential = CircuitValidator::isValidCircuit(*circuit);
+  ValidationOptions options;
+  options.numberOfThreads = 4;
+  ValidationResult parallel = CircuitValidator::isValidCircuit(*circuit, options);
+  // Verify results.
+  EXPECT_FALSE(parallel.isValid);
+  ASSERT_EQ(parallel.errors.size(), sequential.errors.size());
+  EXPECT_EQ(parallel.errors.size(), 8);
+  for (size_t k = 0; k < sequential.errors.size(); k++) {
+    EXPECT_EQ(parallel.errors.at(k).code, sequential.errors.at(k).code);
+    EXPECT_EQ(parallel.errors.at(k).elementKind, sequential.errors.at(k).elementKind);
+    EXPECT_EQ(parallel.errors.at(k).elementId, sequential.errors.at(k).elementId);
+  }
+}
+
+/// @brief Test parallel validation of a valid circuit.
+TEST(circuit_validator, parallel_valid_circuit) {
+  // Build a long DC chain.
+  const uint32_t length = 50000;
+  CircuitBuilder builder;
+  builder.addComponent(
+      {ComponentType::GROUND, 0, 0, 0, 0, TerminalRole::NEGATIVE, TerminalRole::NEGATIVE});
+  for (uint32_t k = 0; k < length; k++) {
+    builder.addComponent({ComponentType::RESISTOR, k + 1, 1, k + 1, k, TerminalRole::NEGATIVE,
+                          TerminalRole::POSITIVE});
+  }
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Validate the circuit.
+  ValidationOptions options;
+  options.numberOfThreads = 0;
+  ValidationResult result = CircuitValidator::isValidCircuit(*circuit, options);
+  // Verify results.
+  EXPECT_TRUE(result.isValid);
+}
+
+/// @brief Test that messages and locations are rendered from the error records.
+TEST(circuit_validator, error_text_is_rendered) {
+  // Create circuit with one free bus with a large ID.
+  Circuit circuit;
+  circuit.setBuses({std::make_shared<Bus>(123456)});
+  // Validate the circuit.
+  ValidationResult result = CircuitValidator::isValidCircuit(circuit);
+  // Verify results.
+  ASSERT_EQ(result.errors.size(), 2);
+  EXPECT_EQ(result.errors.at(0).getMessage(), "Bus without connections.");
+  EXPECT_EQ(result.errors.at(0).getLocation(), "Bus - 123456");
+  EXPECT_EQ(result.errors.at(1).getMessage(), "Ground component is missing.");
+  EXPECT_EQ(result.errors.at(1).getLocation(), "");
+}
+
+/// @brief Test that validation stops at the first error in fail-fast mode.
+TEST(circuit_validator, fail_fast) {
+  // Create circuit with many free buses.
+  Circuit circuit;
+  std::vector<std::shared_ptr<Bus>> buses;
+  for (BusId id = 0; id < 1000; id++) {
+    buses.push_back(std::make_shared<Bus>(id));
+  }
+  circuit.setBuses(buses);
+  // Validate the circuit.
+  ValidationOptions options;
+  options.failFast = true;
+  ValidationResult result = CircuitValidator::isValidCircuit(circuit, options);
+  // Verify results.
+  EXPECT_FALSE(result.isValid);
+  EXPECT_TRUE(result.isTruncated);
+  ASSERT_EQ(result.errors.size(), 1);
+  EXPECT_EQ(result.errors.at(0).code, ValidationErrorCode::UNCONNECTED_BUS);
+  EXPECT_EQ(result.errors.at(0).elementId, 0);
+}
+
+/// @brief Test that an error limit keeps the first errors of the full list.
+TEST(circuit_validator, error_limit_keeps_prefix) {
+  // Create circuit with a free bus, two unconnected components and no ground.
+  Circuit circuit(SimulationMode::AC);
+  circuit.setBuses({std::make_shared<Bus>(1), std::make_shared<Bus>(2)});
+  circuit.setComponents(
+      {std::make_shared<DCCurrentSource>(1, 1.0f), std::make_shared<DCCurrentSource>(1, 1.0f)});
+  ValidationResult full = CircuitValidator::isValidCircuit(circuit);
+  for (size_t limit = 1; limit <= full.errors.size() + 1; limit++) {
+    // Validate the circuit with a limit.
+    ValidationOptions options;
+    options.maxErrors = limit;
+    ValidationResult result = CircuitValidator::isValidCircuit(circuit, options);
+    // Verify results.
+    ASSERT_EQ(result.errors.size(), std::min(limit, full.errors.size()));
+    EXPECT_EQ(result.isTruncated, limit < full.errors.size());
+    for (size_t k = 0; k < result.errors.size(); k++) {
+      EXPECT_EQ(result.errors.at(k).code, full.errors.at(k).code);
+      EXPECT_EQ(result.errors.at(k).elementId, full.errors.at(k).elementId);
+    }
+  }
+}
+
+/// @brief Test that a result with exactly as many errors as the limit is not truncated.
+TEST(circuit_validator, error_limit_reached_exactly) {
+  // Create a valid circuit with two unconnected components added.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  auto components = circuit->getComponents();
+  components.push_back(std::make_shared<DCCurrentSource>(1001, 1.0f));
+  components.push_back(std::make_shared<DCCurrentSource>(1002, 1.0f));
+  circuit->setComponents(components);
+  // Validate the circuit with limits of two and one.
+  ValidationOptions options;
+  options.maxErrors = 2;
+  ValidationResult exact = CircuitValidator::isValidCircuit(*circuit, options);
+  options.maxErrors = 1;
+  ValidationResult truncated = CircuitValidator::isValidCircuit(*circuit, options);
+  // Verify results.
+  ASSERT_EQ(exact.errors.size(), 2);
+  EXPECT_FALSE(exact.isTruncated);
+  ASSERT_EQ(truncated.errors.size(), 1);
+  EXPECT_TRUE(truncated.isTruncated);
+}
@@ -0,0 +1,66 @@
+//==============================================================================
+// File:        test_concurrent_disjoint_set.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for ConcurrentDisjointSet class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover ConcurrentDisjointSet class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=concurrent_disjoint_set.*
+//==============================================================================
+
+#include "concurrent_disjoint_set.hpp"
+#include "thread_pool.hpp"
+#include <gtest/gtest.h>
+
+using namespace ocira::core;
+
+/// @brief Test merging sets on a single thread.
+TEST(concurrent_disjoint_set, unite_merges_sets) {
+  // Create structure and merge elements.
+  ConcurrentDisjointSet sets(5);
+  EXPECT_TRUE(sets.unite(4, 1));
+  EXPECT_TRUE(sets.unite(3, 4));
+  EXPECT_FALSE(sets.unite(1, 3));
+  // Verify results.
+  EXPECT_EQ(sets.getSize(), 5);
+  EXPECT_EQ(sets.find(4), 1);
+  EXPECT_EQ(sets.find(3), 1);
+  EXPECT_EQ(sets.find(2), 2);
+}
+
+/// @brief Test that unions from many threads give the same partition as on one thread.
+TEST(concurrent_disjoint_set, parallel_unions) {
+  // Link every element to the one 1000 positions ahead, from several threads.
+  const uint32_t size = 100000;
+  const uint32_t stride = 1000;
+  ConcurrentDisjointSet sets(size);
+  ThreadPool pool(4);
+  pool.run(16, [&](size_t task) {
+    for (uint32_t k = static_cast<uint32_t>(task); k + stride < size; k += 16) {
+      sets.unite(k + stride, k);
+    }
+  });
+  // Verify results: one set per residue class, represented by its smallest element.
+  for (uint32_t k = 0; k < size; k++) {
+    ASSERT_EQ(sets.find(k), k % stride);
+  }
+}
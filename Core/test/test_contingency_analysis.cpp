@@ -0,0 +1,138 @@
+//==============================================================================
+// File:        test_contingency_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for ContingencyAnalysis class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover ContingencyAnalysis class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=contingency_analysis.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "contingency_analysis.hpp"
+#include "thread_pool.hpp"
+#include <armadillo>
+#include <complex>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+
+namespace {
+
+/// @brief Components of a DC ladder: 10 V at bus 1, 100 ohm to bus 2, which has 200 ohm and
+/// 300 ohm to ground, 1 mA injected and 50 ohm on to bus 3, which has 150 ohm on to bus 4. Buses
+/// 3 and 4 have no other path to ground.
+std::vector<ComponentDescriptor> getLadderDescriptors() {
+  return {
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 100, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 4, 200, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 5, 300, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::DC_CURRENT_SOURCE, 6, 1e-3f, 0, 2, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 7, 50, 2, 3, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 8, 150, 3, 4, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  };
+}
+
+/// @brief Builds the ladder with one component left out.
+std::shared_ptr<Circuit> makeLadder(ComponentId outage = 0) {
+  CircuitBuilder builder;
+  std::vector<ComponentDescriptor> descriptors;
+  for (const ComponentDescriptor &descriptor : getLadderDescriptors()) {
+    if (descriptor.id != outage) {
+      descriptors.push_back(descriptor);
+    }
+  }
+  builder.addComponents(descriptors);
+  return builder.build();
+}
+
+} // namespace
+
+/// @brief Test every outage of a DC ladder against a full solve without the component.
+TEST(contingency_analysis, matches_full_solves) {
+  // Outage every resistor and the current source.
+  ThreadPool pool(3);
+  ContingencyResult result = ContingencyAnalysis::run(makeLadder(), ContingencyOptions(), pool);
+  // Verify results. Buses are 0 to 4.
+  ASSERT_EQ(result.componentIds, (std::vector<ComponentId>{3, 4, 5, 6, 7, 8}));
+  ASSERT_EQ(result.voltages.n_rows, 5);
+  ASSERT_EQ(result.voltages.n_cols, 6);
+  for (size_t m = 0; m < result.componentIds.size(); m++) {
+    if (result.isIslanding[m]) {
+      continue;
+    }
+    auto circuit = makeLadder(result.componentIds[m]);
+    CircuitTransformer transformer(circuit);
+    const arma::cx_vec x = CircuitFactorization(*transformer.getAdmittanceMatrix())
+                               .solve(*transformer.getCurrentVector());
+    for (size_t k = 0; k < result.busIds.size(); k++) {
+      const BusNumber row = transformer.getBusIdMap().at(result.busIds[k]);
+      const std::complex<double> expected = row != 0 ? x(row - 1) : 0.0;
+      EXPECT_NEAR(std::abs(result.voltages(k, m) - expected), 0.0, 1e-9);
+    }
+  }
+}
+
+/// @brief Test that removing the only path to ground of buses is flagged as islanding.
+TEST(contingency_analysis, detects_islanding) {
+  // Removing resistor 7 cuts off buses 3 and 4, removing resistor 8 bus 4.
+  ThreadPool pool(2);
+  ContingencyResult result = ContingencyAnalysis::run(makeLadder(), ContingencyOptions(), pool);
+  // Verify results.
+  EXPECT_EQ(result.numberOfIslandingOutages, 2);
+  EXPECT_TRUE(result.isIslanding[4]);
+  EXPECT_TRUE(result.isIslanding[5]);
+  EXPECT_EQ(result.voltages(3, 4), std::complex<double>(0.0));
+  EXPECT_NEAR(std::abs(result.baseVoltages(4) - result.baseVoltages(2)), 0.0, 1e-9);
+  for (size_t m = 0; m < 4; m++) {
+    EXPECT_FALSE(result.isIslanding[m]);
+  }
+}
+
+/// @brief Test the voltage limit flags.
+TEST(contingency_analysis, voltage_limits) {
+  // Bus 2 is at 5.5 V. Without the feeder resistor only the 1 mA source drives it.
+  ThreadPool pool(4);
+  ContingencyOptions options;
+  options.minimumVoltage = 1.0;
+  options.maximumVoltage = 10.0;
+  ContingencyResult result = ContingencyAnalysis::run(makeLadder(), options, pool);
+  // Verify results.
+  EXPECT_TRUE(result.violatesLimits[0]);
+  EXPECT_FALSE(result.violatesLimits[1]);
+  EXPECT_FALSE(result.violatesLimits[3]);
+  EXPECT_EQ(result.numberOfViolatingOutages, 1);
+  options.minimumVoltage = 20.0;
+  EXPECT_THROW(ContingencyAnalysis::run(makeLadder(), options, pool), std::runtime_error);
+}
@@ -0,0 +1,87 @@
+//==============================================================================
+// File:        test_dc_sweep.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for DCSweep class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover DCSweep class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=dc_sweep.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "dc_sweep.hpp"
+#include "example_circuit_generator.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::test::helpers;
+
+/// @brief Test a sweep of one voltage source.
+TEST(dc_sweep, single_source) {
+  // Sweep the voltage from -5 V to 5 V.
+  auto circuit = ExampleCircuitGenerator::getDividerCircuit(SimulationMode::DC, true);
+  std::vector<float> values = DCSweep::linearValues(-5.0f, 5.0f, 11);
+  DCSweepResult result = DCSweep::run(circuit, 2, values);
+  // Verify results. The source current is the third unknown and leaves the source.
+  ASSERT_EQ(result.solutions.n_cols, 11);
+  for (size_t k = 0; k < values.size(); k++) {
+    EXPECT_NEAR(result.solutions(0, k).real(), values[k], 1e-5);
+    EXPECT_NEAR(result.solutions(1, k).real(), values[k] / 2.0 + 0.5, 1e-5);
+    EXPECT_NEAR(result.solutions(2, k).real(), -(values[k] - 0.5 - values[k] / 2.0) / 1000.0,
+                1e-8);
+  }
+}
+
+/// @brief Test a nested sweep of a voltage and a current source.
+TEST(dc_sweep, nested_sources) {
+  // 3 voltages outside, 4 currents inside.
+  auto circuit = ExampleCircuitGenerator::getDividerCircuit(SimulationMode::DC, true);
+  std::vector<DCSweepAxis> axes = {{2, {0.0f, 5.0f, 10.0f}}, {5, {-2e-3f, 0.0f, 1e-3f, 4e-3f}}};
+  DCSweepResult result = DCSweep::run(circuit, axes);
+  // Verify results.
+  ASSERT_EQ(result.solutions.n_cols, 12);
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 4; j++) {
+      const double expected = axes[0].values[i] / 2.0 + 500.0 * axes[1].values[j];
+      EXPECT_NEAR(result.solutions(1, i * 4 + j).real(), expected, 1e-5);
+    }
+  }
+}
+
+/// @brief Test that invalid sweeps are rejected.
+TEST(dc_sweep, rejects_invalid_input) {
+  // Set up.
+  auto circuit = ExampleCircuitGenerator::getDividerCircuit(SimulationMode::DC, true);
+  auto acCircuit = ExampleCircuitGenerator::getDividerCircuit(SimulationMode::AC, true);
+  // Verify results.
+  EXPECT_THROW(DCSweep::run(circuit, std::vector<DCSweepAxis>{}), std::runtime_error);
+  EXPECT_THROW(DCSweep::run(circuit, 3, {1.0f}), std::runtime_error);
+  EXPECT_THROW(DCSweep::run(circuit, 9, {1.0f}), std::runtime_error);
+  EXPECT_THROW(DCSweep::run(circuit, 2, {}), std::runtime_error);
+  EXPECT_THROW(DCSweep::run(circuit, {{2, {1.0f}}, {2, {2.0f}}}), std::runtime_error);
+  EXPECT_THROW(DCSweep::run(acCircuit, 2, {1.0f}), std::runtime_error);
+  EXPECT_THROW(DCSweep::linearValues(0.0f, 1.0f, 0), std::runtime_error);
+}
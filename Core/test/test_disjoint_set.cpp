@@ -0,0 +1,84 @@
+//==============================================================================
+// File:        test_disjoint_set.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for DisjointSet class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover DisjointSet class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=disjoint_set.*
+//==============================================================================
+
+#include "disjoint_set.hpp"
+#include <gtest/gtest.h>
+
+using namespace ocira::core;
+
+/// @brief Test that a new structure contains only singleton sets.
+TEST(disjoint_set, starts_with_singletons) {
+  // Create structure.
+  DisjointSet sets(4);
+  // Verify results.
+  EXPECT_EQ(sets.getSize(), 4);
+  EXPECT_EQ(sets.getNumberOfSets(), 4);
+  for (uint32_t k = 0; k < 4; k++) {
+    EXPECT_EQ(sets.find(k), k);
+  }
+}
+
+/// @brief Test merging sets.
+TEST(disjoint_set, unite_merges_sets) {
+  // Create structure and merge elements.
+  DisjointSet sets(5);
+  EXPECT_TRUE(sets.unite(0, 1));
+  EXPECT_TRUE(sets.unite(3, 4));
+  EXPECT_TRUE(sets.unite(1, 4));
+  EXPECT_FALSE(sets.unite(0, 3));
+  // Verify results.
+  EXPECT_EQ(sets.getNumberOfSets(), 2);
+  EXPECT_EQ(sets.find(0), sets.find(4));
+  EXPECT_NE(sets.find(2), sets.find(0));
+}
+
+/// @brief Test adding elements after construction.
+TEST(disjoint_set, add_elements) {
+  // Create empty structure and add elements.
+  DisjointSet sets;
+  uint32_t first = sets.add();
+  uint32_t second = sets.add();
+  sets.unite(first, second);
+  // Verify results.
+  EXPECT_EQ(sets.getSize(), 2);
+  EXPECT_EQ(sets.getNumberOfSets(), 1);
+}
+
+/// @brief Test that a long chain is merged without deep recursion.
+TEST(disjoint_set, long_chain) {
+  // Create a chain of one million elements.
+  const uint32_t size = 1000000;
+  DisjointSet sets(size);
+  for (uint32_t k = 1; k < size; k++) {
+    sets.unite(k - 1, k);
+  }
+  // Verify results.
+  EXPECT_EQ(sets.getNumberOfSets(), 1);
+  EXPECT_EQ(sets.find(0), sets.find(size - 1));
+}
@@ -0,0 +1,157 @@
+//==============================================================================
+// File:        test_factorization_store.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for FactorizationStore class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover FactorizationStore class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=factorization_store.*
+//==============================================================================
+
+#include "circuit_factorization.hpp"
+#include "circuit_fingerprint.hpp"
+#include "circuit_transformer.hpp"
+#include "example_circuit_generator.hpp"
+#include "factorization_store.hpp"
+#include "solution_cache.hpp"
+#include <armadillo>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::test::helpers;
+
+namespace {
+
+/// @brief Returns an empty directory for one test.
+std::string makeStoreDirectory(const std::string &name) {
+  auto path = std::filesystem::temp_directory_path() / ("ocira_factorization_store_" + name);
+  std::filesystem::remove_all(path);
+  return path.string();
+}
+
+} // namespace
+
+/// @brief Test that a saved factorization loads with identical factors.
+TEST(factorization_store, round_trip) {
+  // Factorize example circuit 3 and save it.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  CircuitTransformer transformer(circuit);
+  CircuitFactorization factorization(*transformer.getAdmittanceMatrix());
+  const CircuitFingerprint fingerprint = CircuitFingerprinter::compute(*circuit);
+  FactorizationStore store(makeStoreDirectory("round_trip"));
+  ASSERT_TRUE(store.save(fingerprint, factorization));
+  // Load it again.
+  auto loaded = store.load(fingerprint);
+  // Verify results.
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ(loaded->getPermutation(), factorization.getPermutation());
+  for (arma::uword k = 0; k < factorization.getLower().n_elem; k++) {
+    EXPECT_EQ(loaded->getLower()(k), factorization.getLower()(k));
+    EXPECT_EQ(loaded->getUpper()(k), factorization.getUpper()(k));
+  }
+}
+
+/// @brief Test that missing and mismatching files are reported as misses.
+TEST(factorization_store, mismatch_is_miss) {
+  // Save the factorization of example circuit 1.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  CircuitTransformer transformer(circuit);
+  const CircuitFingerprint fingerprint = CircuitFingerprinter::compute(*circuit);
+  FactorizationStore store(makeStoreDirectory("mismatch"));
+  store.save(fingerprint, CircuitFactorization(*transformer.getAdmittanceMatrix()));
+  // Look up an unknown fingerprint and one with a different topology hash.
+  CircuitFingerprint unknown = fingerprint;
+  unknown.admittance++;
+  CircuitFingerprint otherTopology = fingerprint;
+  otherTopology.topology++;
+  // Verify results.
+  EXPECT_EQ(store.load(unknown), nullptr);
+  EXPECT_EQ(store.load(otherTopology), nullptr);
+  EXPECT_NE(store.load(fingerprint), nullptr);
+}
+
+/// @brief Test that a truncated file is reported as a miss.
+TEST(factorization_store, truncated_file_is_miss) {
+  // Save the factorization of example circuit 3 and cut the file short.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  CircuitTransformer transformer(circuit);
+  const CircuitFingerprint fingerprint = CircuitFingerprinter::compute(*circuit);
+  FactorizationStore store(makeStoreDirectory("truncated"));
+  store.save(fingerprint, CircuitFactorization(*transformer.getAdmittanceMatrix()));
+  const std::string path = store.getPath(fingerprint);
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+  // Verify results.
+  EXPECT_EQ(store.load(fingerprint), nullptr);
+}
+
+/// @brief Test that concurrent saves of the same key leave one valid file and no temporary files.
+TEST(factorization_store, concurrent_saves) {
+  // Save the factorization of example circuit 3 from several threads at once.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  CircuitTransformer transformer(circuit);
+  CircuitFactorization factorization(*transformer.getAdmittanceMatrix());
+  const CircuitFingerprint fingerprint = CircuitFingerprinter::compute(*circuit);
+  const std::string directory = makeStoreDirectory("concurrent");
+  FactorizationStore store(directory);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&]() {
+      for (int k = 0; k < 10; k++) {
+        store.save(fingerprint, factorization);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  // Verify results.
+  auto loaded = store.load(fingerprint);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ(loaded->getPermutation(), factorization.getPermutation());
+  size_t numberOfFiles = 0;
+  for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+    EXPECT_NE(entry.path().extension(), ".tmp");
+    numberOfFiles++;
+  }
+  EXPECT_EQ(numberOfFiles, 1);
+}
+
+/// @brief Test that a new solution cache loads factorizations saved by an earlier one.
+TEST(factorization_store, solution_cache_uses_store) {
+  // Solve example circuit 1 with one cache, then with a fresh cache on the same store.
+  auto store = std::make_shared<const FactorizationStore>(makeStoreDirectory("cache"));
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  SolutionCache first(4, 4, store);
+  first.solve(circuit);
+  const std::string path = store->getPath(CircuitFingerprinter::compute(*circuit));
+  const bool saved = std::filesystem::exists(path);
+  SolutionCache second(4, 4, store);
+  auto solution = second.solve(circuit);
+  // Verify results.
+  EXPECT_TRUE(saved);
+  EXPECT_FLOAT_EQ((*solution)(0).real(), 200.0f);
+}
@@ -0,0 +1,154 @@
+//==============================================================================
+// File:        test_frequency_sweep.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for FrequencySweep class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover FrequencySweep class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=frequency_sweep.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_calculator.hpp"
+#include "circuit_transformer.hpp"
+#include "example_circuit_generator.hpp"
+#include "frequency_sweep.hpp"
+#include "resistor.hpp"
+#include <algorithm>
+#include <armadillo>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::test::helpers;
+
+/// @brief Test the point generators.
+TEST(frequency_sweep, point_generators) {
+  // Generate linear and logarithmic points.
+  std::vector<float> linear = FrequencySweep::linearPoints(10.0f, 50.0f, 5);
+  std::vector<float> logarithmic = FrequencySweep::logarithmicPoints(1.0f, 1000.0f, 4);
+  // Verify results.
+  ASSERT_EQ(linear.size(), 5);
+  EXPECT_FLOAT_EQ(linear[1], 20.0f);
+  EXPECT_FLOAT_EQ(linear[4], 50.0f);
+  ASSERT_EQ(logarithmic.size(), 4);
+  EXPECT_FLOAT_EQ(logarithmic[1], 10.0f);
+  EXPECT_FLOAT_EQ(logarithmic[3], 1000.0f);
+  EXPECT_EQ(FrequencySweep::linearPoints(5.0f, 9.0f, 1), std::vector<float>{5.0f});
+  EXPECT_THROW(FrequencySweep::logarithmicPoints(0.0f, 10.0f, 3), std::runtime_error);
+  EXPECT_THROW(FrequencySweep::linearPoints(1.0f, 10.0f, 0), std::runtime_error);
+}
+
+/// @brief Test that every point matches a serial solve at the same frequency.
+TEST(frequency_sweep, matches_serial_solves) {
+  // Sweep example circuit 3 on four threads.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  std::vector<float> frequencies = FrequencySweep::logarithmicPoints(1.0f, 1.0e5f, 23);
+  FrequencySweepResult result = FrequencySweep::run(circuit, frequencies, 4);
+  // Verify results against solving the circuit point by point.
+  ASSERT_EQ(result.frequencies, frequencies);
+  ASSERT_EQ(result.solutions.n_cols, frequencies.size());
+  for (size_t k = 0; k < frequencies.size(); k++) {
+    circuit->setFrequency(frequencies[k]);
+    CircuitTransformer transformer(circuit);
+    auto expected = CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                                     transformer.getCurrentVector());
+    ASSERT_EQ(result.solutions.n_rows, expected->n_elem);
+    for (arma::uword row = 0; row < expected->n_elem; row++) {
+      EXPECT_EQ(result.solutions(row, k), (*expected)(row));
+    }
+  }
+}
+
+/// @brief Test that a single frequency works and that the circuit is left unchanged.
+TEST(frequency_sweep, single_point_keeps_circuit) {
+  // Sweep example circuit 3 at one explicit frequency.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  FrequencySweepResult result = FrequencySweep::run(circuit, {60.0f}, 2);
+  // Verify results.
+  EXPECT_EQ(result.solutions.n_cols, 1);
+  EXPECT_FLOAT_EQ(circuit->getFrequency(), 50.0f);
+}
+
+/// @brief Test that DC circuits and empty lists are rejected.
+TEST(frequency_sweep, rejects_invalid_input) {
+  // Verify results.
+  EXPECT_THROW(FrequencySweep::run(ExampleCircuitGenerator::getExampleCircuit1(), {50.0f}, 1),
+               std::runtime_error);
+  EXPECT_THROW(FrequencySweep::run(ExampleCircuitGenerator::getExampleCircuit3(), {}, 1),
+               std::runtime_error);
+}
+
+/// @brief Test that an adaptive sweep concentrates samples around a sharp resonance.
+TEST(frequency_sweep, adaptive_refines_resonance) {
+  // Make the series RLC of example circuit 3 sharp (Q = 100, resonance near 159 Hz).
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  std::static_pointer_cast<Resistor>(circuit->getComponents().at(3))->setResistance(0.01f);
+  AdaptiveSweepOptions options;
+  options.initialPoints = 41;
+  options.tolerance = 1e-3;
+  ThreadPool pool(4);
+  AdaptiveSweepResult result = FrequencySweep::runAdaptive(circuit, 1.0f, 1.0e5f, options, pool);
+  // Verify results.
+  const std::vector<float> &frequencies = result.sweep.frequencies;
+  ASSERT_EQ(frequencies.size(), result.numberOfSolves);
+  ASSERT_EQ(result.sweep.solutions.n_cols, frequencies.size());
+  EXPECT_TRUE(result.converged);
+  EXPECT_TRUE(std::is_sorted(frequencies.begin(), frequencies.end()));
+  EXPECT_FLOAT_EQ(frequencies.front(), 1.0f);
+  EXPECT_FLOAT_EQ(frequencies.back(), 1.0e5f);
+  EXPECT_LT(result.numberOfSolves * 4, result.numberOfDenseSolves);
+  // More samples within a decade of the resonance than in the two decades at the top.
+  auto count = [&](float low, float high) {
+    return std::count_if(frequencies.begin(), frequencies.end(),
+                         [&](float f) { return f >= low && f < high; });
+  };
+  EXPECT_GT(count(50.0f, 500.0f), count(1000.0f, 1.0e5f));
+  // Samples are exact solves.
+  circuit->setFrequency(frequencies[7]);
+  CircuitTransformer transformer(circuit);
+  auto expected = CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                                   transformer.getCurrentVector());
+  for (arma::uword row = 0; row < expected->n_elem; row++) {
+    EXPECT_EQ(result.sweep.solutions(row, 7), (*expected)(row));
+  }
+}
+
+/// @brief Test that the point budget stops the refinement.
+TEST(frequency_sweep, adaptive_respects_budget) {
+  // Ask for a tolerance that cannot be reached with 30 points.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  AdaptiveSweepOptions options;
+  options.initialPoints = 5;
+  options.tolerance = 1e-9;
+  options.maxPoints = 30;
+  ThreadPool pool(2);
+  AdaptiveSweepResult result = FrequencySweep::runAdaptive(circuit, 1.0f, 1.0e5f, options, pool);
+  // Verify results.
+  EXPECT_EQ(result.numberOfSolves, 30);
+  EXPECT_FALSE(result.converged);
+  EXPECT_THROW(FrequencySweep::runAdaptive(circuit, 10.0f, 1.0f, options, pool),
+               std::runtime_error);
+}
@@ -0,0 +1,256 @@
+//==============================================================================
+// File:        test_incremental_validator.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for IncrementalValidator class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover IncrementalValidator class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=incremental_validator.*
+//==============================================================================
+
+#include "bus.hpp"
+#include "capacitor.hpp"
+#include "circuit.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_validator.hpp"
+#include "component.hpp"
+#include "connection_manager.hpp"
+#include "dc_current_source.hpp"
+#include "example_circuit_generator.hpp"
+#include "ground.hpp"
+#include "incremental_validator.hpp"
+#include "resistor.hpp"
+#include "subcircuit.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::managers;
+using namespace ocira::core::test::helpers;
+
+/// @brief Returns the error codes of a validation result.
+static std::vector<ValidationErrorCode> getCodes(const ValidationResult &result) {
+  std::vector<ValidationErrorCode> codes;
+  for (const ValidationError &error : result.errors) {
+    codes.push_back(error.code);
+  }
+  return codes;
+}
+
+/// @brief Test that the validator agrees with CircuitValidator on the example circuits.
+TEST(incremental_validator, matches_circuit_validator) {
+  // Get example circuits.
+  std::vector<std::shared_ptr<Circuit>> circuits = {
+      ExampleCircuitGenerator::getExampleCircuit1(), ExampleCircuitGenerator::getExampleCircuit2(),
+      ExampleCircuitGenerator::getExampleCircuit3()};
+  for (const std::shared_ptr<Circuit> &circuit : circuits) {
+    // Validate the circuit in both ways.
+    IncrementalValidator validator(*circuit);
+    ValidationResult expected = CircuitValidator::isValidCircuit(*circuit);
+    // Verify results.
+    EXPECT_TRUE(validator.getResult().isValid);
+    EXPECT_EQ(getCodes(validator.getResult()), getCodes(expected));
+  }
+}
+
+/// @brief Test building a circuit step by step through the validator.
+TEST(incremental_validator, build_circuit_with_edits) {
+  // Create validator for an empty DC circuit.
+  IncrementalValidator validator;
+  EXPECT_EQ(getCodes(validator.getResult()),
+            std::vector<ValidationErrorCode>{ValidationErrorCode::GROUND_COMPONENT_MISSING});
+  // Add buses and components.
+  auto bus1 = std::make_shared<Bus>(1);
+  auto bus2 = std::make_shared<Bus>(2);
+  auto ground = std::make_shared<Ground>(1);
+  auto source = std::make_shared<DCCurrentSource>(2, 1.0f);
+  validator.addBus(bus1);
+  validator.addBus(bus2);
+  validator.addComponent(ground);
+  validator.addComponent(source);
+  EXPECT_EQ(getCodes(validator.getResult()),
+            (std::vector<ValidationErrorCode>{ValidationErrorCode::UNCONNECTED_BUS,
+                                              ValidationErrorCode::UNCONNECTED_BUS,
+                                              ValidationErrorCode::UNCONNECTED_COMPONENT,
+                                              ValidationErrorCode::UNCONNECTED_COMPONENT,
+                                              ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED}));
+  // Connect everything.
+  validator.connect(bus1, ground, TerminalRole::NEGATIVE);
+  validator.connect(bus1, source, TerminalRole::NEGATIVE);
+  validator.connect(bus2, source, TerminalRole::POSITIVE);
+  // Verify results.
+  EXPECT_TRUE(validator.getResult().isValid);
+  EXPECT_EQ(validator.getResult().errors.size(), 0);
+}
+
+/// @brief Test that removing connections splits the circuit.
+TEST(incremental_validator, disconnect_splits_circuit) {
+  // Get example circuit 1 and track it.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  IncrementalValidator validator(*circuit);
+  ASSERT_TRUE(validator.getResult().isValid);
+  // Disconnect the source and the resistor from bus 2.
+  std::shared_ptr<Bus> bus = circuit->getBuses().at(1);
+  std::shared_ptr<Component> source = circuit->getComponents().at(0);
+  std::shared_ptr<Component> resistor = circuit->getComponents().at(1);
+  validator.disconnect(bus, source);
+  validator.disconnect(bus, resistor);
+  // Verify results.
+  EXPECT_EQ(getCodes(validator.getResult()),
+            (std::vector<ValidationErrorCode>{ValidationErrorCode::UNCONNECTED_BUS,
+                                              ValidationErrorCode::UNCONNECTED_COMPONENT,
+                                              ValidationErrorCode::UNCONNECTED_COMPONENT,
+                                              ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED}));
+  // Reconnect and verify again.
+  validator.connect(bus, source, TerminalRole::POSITIVE);
+  validator.connect(bus, resistor, TerminalRole::NEGATIVE);
+  EXPECT_TRUE(validator.getResult().isValid);
+}
+
+/// @brief Test that removals split only the affected part and agree with CircuitValidator.
+TEST(incremental_validator, removals_split_connectivity) {
+  // Create a ring of six buses joined by resistors, grounded at bus 1.
+  std::vector<std::shared_ptr<Bus>> buses;
+  std::vector<std::shared_ptr<Component>> components;
+  for (BusId id = 1; id <= 6; id++) {
+    buses.push_back(std::make_shared<Bus>(id));
+  }
+  for (ComponentId id = 1; id <= 6; id++) {
+    components.push_back(std::make_shared<Resistor>(id, 10));
+  }
+  auto ground = std::make_shared<Ground>(7);
+  components.push_back(ground);
+  IncrementalValidator validator;
+  for (const std::shared_ptr<Bus> &bus : buses) {
+    validator.addBus(bus);
+  }
+  for (const std::shared_ptr<Component> &component : components) {
+    validator.addComponent(component);
+  }
+  for (size_t i = 0; i < 6; i++) {
+    validator.connect(buses[i], components[i], TerminalRole::POSITIVE);
+    validator.connect(buses[(i + 1) % 6], components[i], TerminalRole::NEGATIVE);
+  }
+  validator.connect(buses[0], ground, TerminalRole::NEGATIVE);
+  // Compares the validator with CircuitValidator on the same elements.
+  auto expectMatch = [&]() {
+    Circuit circuit;
+    circuit.setBuses(buses);
+    circuit.setComponents(components);
+    EXPECT_EQ(getCodes(validator.getResult()),
+              getCodes(CircuitValidator::isValidCircuit(circuit)));
+  };
+  const std::vector<ValidationErrorCode> oneOpenResistor = {
+      ValidationErrorCode::UNCONNECTED_COMPONENT};
+  const std::vector<ValidationErrorCode> splitCircuit = {
+      ValidationErrorCode::UNCONNECTED_COMPONENT, ValidationErrorCode::UNCONNECTED_COMPONENT,
+      ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED};
+  EXPECT_TRUE(validator.getResult().isValid);
+  // Open the ring between bus 3 and bus 4. The ring still holds together.
+  validator.disconnect(buses[3], components[2]);
+  EXPECT_EQ(getCodes(validator.getResult()), oneOpenResistor);
+  expectMatch();
+  // Open it again between bus 6 and bus 1, which splits off buses 4 to 6.
+  validator.disconnect(buses[0], components[5]);
+  EXPECT_EQ(getCodes(validator.getResult()), splitCircuit);
+  expectMatch();
+  // Close the first gap again.
+  validator.connect(buses[3], components[2], TerminalRole::NEGATIVE);
+  EXPECT_EQ(getCodes(validator.getResult()), oneOpenResistor);
+  expectMatch();
+  // Remove the resistor between bus 4 and bus 5, which splits off buses 5 and 6.
+  std::shared_ptr<Component> removed = components[3];
+  EXPECT_TRUE(validator.removeComponent(removed));
+  components.erase(components.begin() + 3);
+  ConnectionManager::disconnectBusAndComponent(buses[3], removed);
+  ConnectionManager::disconnectBusAndComponent(buses[4], removed);
+  EXPECT_EQ(getCodes(validator.getResult()),
+            (std::vector<ValidationErrorCode>{ValidationErrorCode::UNCONNECTED_COMPONENT,
+                                              ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED}));
+  expectMatch();
+  // Remove buses 5 and 6, which leaves the remaining buses connected.
+  EXPECT_TRUE(validator.removeBus(buses[5]));
+  EXPECT_TRUE(validator.removeBus(buses[4]));
+  buses.resize(4);
+  EXPECT_EQ(getCodes(validator.getResult()), oneOpenResistor);
+  expectMatch();
+}
+
+/// @brief Test that duplicate identifiers are reported until the duplicate is removed.
+TEST(incremental_validator, duplicate_identifiers) {
+  // Get example circuit 1 and track it.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  IncrementalValidator validator(*circuit);
+  // Add a second component with an existing ID.
+  auto duplicate = std::make_shared<Resistor>(circuit->getComponents().at(0)->getId(), 10);
+  validator.addComponent(duplicate);
+  const ValidationResult &result = validator.getResult();
+  // Verify results.
+  EXPECT_FALSE(result.isValid);
+  EXPECT_EQ(getCodes(result), (std::vector<ValidationErrorCode>{
+                                  ValidationErrorCode::UNCONNECTED_COMPONENT,
+                                  ValidationErrorCode::DUPLICATE_IDENTIFIER}));
+  // Remove the duplicate and verify again.
+  EXPECT_TRUE(validator.removeComponent(duplicate));
+  EXPECT_FALSE(validator.removeComponent(duplicate));
+  EXPECT_TRUE(validator.getResult().isValid);
+}
+
+/// @brief Test that changing the simulation mode updates compatibility errors.
+TEST(incremental_validator, simulation_mode_change) {
+  // Get example circuit 3 (AC) and track it.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  IncrementalValidator validator(*circuit);
+  ASSERT_TRUE(validator.getResult().isValid);
+  // Switch to DC.
+  validator.setSimulationMode(SimulationMode::DC);
+  // Verify results.
+  EXPECT_FALSE(validator.getResult().isValid);
+  for (const ValidationError &error : validator.getResult().errors) {
+    EXPECT_EQ(error.code, ValidationErrorCode::INCOMPATIBLE_COMPONENT_FOR_DC_SIMULATION);
+  }
+  // Switch back to AC.
+  validator.setSimulationMode(SimulationMode::AC);
+  EXPECT_TRUE(validator.getResult().isValid);
+}
+
+/// @brief Test that circuits with subcircuit instances are rejected.
+TEST(incremental_validator, rejects_subcircuit_instances) {
+  // Place a one-resistor cell between bus 1 and ground of example circuit 1.
+  auto in = std::make_shared<Bus>(1);
+  auto out = std::make_shared<Bus>(2);
+  auto resistor = std::make_shared<Resistor>(1, 100);
+  ConnectionManager::connectBusAndComponent(in, resistor, TerminalRole::NEGATIVE);
+  ConnectionManager::connectBusAndComponent(out, resistor, TerminalRole::POSITIVE);
+  auto cell = std::make_shared<const SubcircuitDefinition>(
+      std::vector<std::shared_ptr<Bus>>{in, out}, std::vector<std::shared_ptr<Component>>{resistor},
+      std::vector<BusId>{1, 2});
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  const BusId busId = circuit->getBuses().front()->getId();
+  circuit->setSubcircuitInstances(
+      {std::make_shared<const SubcircuitInstance>(1, cell, std::vector<BusId>{busId, busId})});
+  // Verify results.
+  EXPECT_THROW(IncrementalValidator validator(*circuit), std::runtime_error);
+}
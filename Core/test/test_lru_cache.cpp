@@ -0,0 +1,87 @@
+//==============================================================================
+// File:        test_lru_cache.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for LruCache class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover LruCache class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=lru_cache.*
+//==============================================================================
+
+#include "lru_cache.hpp"
+#include <gtest/gtest.h>
+
+using namespace ocira::core;
+
+/// @brief Test that lookups count hits and misses.
+TEST(lru_cache, hits_and_misses) {
+  // Create cache and insert a value.
+  LruCache<int, int> cache(2);
+  cache.insert(1, 10);
+  // Look up present and missing keys.
+  auto hit = cache.find(1);
+  auto miss = cache.find(2);
+  // Verify results.
+  ASSERT_TRUE(hit.has_value());
+  EXPECT_EQ(*hit, 10);
+  EXPECT_FALSE(miss.has_value());
+  EXPECT_EQ(cache.getStatistics().hits, 1);
+  EXPECT_EQ(cache.getStatistics().misses, 1);
+}
+
+/// @brief Test that the least recently used entry is evicted.
+TEST(lru_cache, evicts_least_recently_used) {
+  // Fill cache and touch the oldest entry.
+  LruCache<int, int> cache(2);
+  cache.insert(1, 10);
+  cache.insert(2, 20);
+  cache.find(1);
+  // Insert a third entry.
+  cache.insert(3, 30);
+  // Verify results.
+  EXPECT_EQ(cache.getSize(), 2);
+  EXPECT_TRUE(cache.find(1).has_value());
+  EXPECT_FALSE(cache.find(2).has_value());
+  EXPECT_TRUE(cache.find(3).has_value());
+  EXPECT_EQ(cache.getStatistics().evictions, 1);
+}
+
+/// @brief Test that inserting an existing key replaces the value.
+TEST(lru_cache, replace_value) {
+  // Insert the same key twice.
+  LruCache<int, int> cache(2);
+  cache.insert(1, 10);
+  cache.insert(1, 11);
+  // Verify results.
+  EXPECT_EQ(cache.getSize(), 1);
+  EXPECT_EQ(*cache.find(1), 11);
+}
+
+/// @brief Test that a cache without capacity stores nothing.
+TEST(lru_cache, zero_capacity) {
+  // Create cache and insert a value.
+  LruCache<int, int> cache(0);
+  cache.insert(1, 10);
+  // Verify results.
+  EXPECT_EQ(cache.getSize(), 0);
+  EXPECT_FALSE(cache.find(1).has_value());
+}
@@ -0,0 +1,179 @@
+//==============================================================================
+// File:        test_monte_carlo.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for MonteCarlo and RunningStatistics classes in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover MonteCarlo and RunningStatistics classes.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=monte_carlo.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "example_circuit_generator.hpp"
+#include "monte_carlo.hpp"
+#include "thread_pool.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::test::helpers;
+
+/// @brief Test the moments, extremes and histogram of running statistics.
+TEST(monte_carlo, running_statistics) {
+  // Add 1..10 at once and in two merged halves.
+  RunningStatistics all(0.0, 10.0, 5);
+  RunningStatistics first(0.0, 10.0, 5);
+  RunningStatistics second(0.0, 10.0, 5);
+  for (int k = 1; k <= 10; k++) {
+    all.add(k);
+    (k <= 4 ? first : second).add(k);
+  }
+  first.merge(second);
+  const double mergedMean = first.getMean();
+  const double mergedVariance = first.getVariance();
+  first.add(-1.0);
+  first.add(11.0);
+  // Verify results.
+  EXPECT_EQ(all.getCount(), 10);
+  EXPECT_DOUBLE_EQ(all.getMean(), 5.5);
+  EXPECT_NEAR(all.getVariance(), 55.0 / 6.0, 1e-12);
+  EXPECT_DOUBLE_EQ(all.getMinimum(), 1.0);
+  EXPECT_DOUBLE_EQ(all.getMaximum(), 10.0);
+  EXPECT_EQ(all.getHistogram(), (std::vector<uint64_t>{1, 2, 2, 2, 3}));
+  EXPECT_DOUBLE_EQ(mergedMean, 5.5);
+  EXPECT_NEAR(mergedVariance, 55.0 / 6.0, 1e-12);
+  EXPECT_EQ(first.getCount(), 12);
+  EXPECT_EQ(first.getHistogram(), all.getHistogram());
+  EXPECT_EQ(first.getUnderflow(), 1);
+  EXPECT_EQ(first.getOverflow(), 1);
+  EXPECT_THROW(all.merge(RunningStatistics(0.0, 5.0, 5)), std::runtime_error);
+  EXPECT_THROW(RunningStatistics(1.0, 1.0, 5), std::runtime_error);
+}
+
+/// @brief Test the statistics and yield of a voltage divider with 5 % resistors.
+TEST(monte_carlo, divider_yield) {
+  // Analyse 20000 samples with a +-1 % output window.
+  std::vector<ComponentTolerance> tolerances = {{3, 0.05}, {4, 0.05}};
+  std::vector<MonteCarloOutput> outputs = {{2, 4.95, 5.05}};
+  MonteCarloOptions options;
+  options.numberOfSamples = 20000;
+  options.seed = 7;
+  ThreadPool pool(4);
+  MonteCarloResult result = MonteCarlo::run(ExampleCircuitGenerator::getDividerCircuit(),
+                                            tolerances, outputs, options, pool);
+  // Verify results. The output 10 * R2 / (R1 + R2) is evaluated directly with the same draws.
+  uint64_t passed = 0;
+  for (uint64_t sample = 0; sample < options.numberOfSamples; sample++) {
+    const double r1 = 1000.0 * (1.0 + MonteCarlo::getDeviation(7, sample, 0, tolerances[0]));
+    const double r2 = 1000.0 * (1.0 + MonteCarlo::getDeviation(7, sample, 1, tolerances[1]));
+    const double value = 10.0 * r2 / (r1 + r2);
+    passed += value >= 4.95 && value <= 5.05 ? 1 : 0;
+  }
+  EXPECT_EQ(result.numberOfFailedSamples, 0);
+  EXPECT_NEAR(static_cast<double>(result.numberOfPassedSamples), passed, 2.0);
+  EXPECT_NEAR(result.yield, static_cast<double>(passed) / 20000.0, 1e-4);
+  EXPECT_NEAR(result.nominalValues[0], 5.0, 1e-5);
+  const RunningStatistics &statistics = result.statistics[0];
+  EXPECT_EQ(statistics.getCount(), 20000);
+  EXPECT_NEAR(statistics.getMean(), 5.0, 5e-3);
+  // Linearised: each resistor moves the output by 2.5 mV per ohm, with sigma = 50 / sqrt(3).
+  EXPECT_NEAR(statistics.getStandardDeviation(), 2.5e-3 * 50.0 / std::sqrt(1.5), 5e-3);
+  EXPECT_GE(statistics.getMinimum(), 4.75);
+  EXPECT_LE(statistics.getMaximum(), 5.25);
+  uint64_t binned = 0;
+  for (uint64_t count : statistics.getHistogram()) {
+    binned += count;
+  }
+  EXPECT_EQ(binned, 20000);
+}
+
+/// @brief Test that samples do not depend on the number of threads, only on the seed.
+TEST(monte_carlo, reproducible_samples) {
+  // Run the same analysis on one and on three threads, and with another seed.
+  std::vector<ComponentTolerance> tolerances = {{2, 0.1, ToleranceDistribution::GAUSSIAN},
+                                                {3, 0.05}};
+  std::vector<MonteCarloOutput> outputs = {{2, 4.9, 5.1}};
+  MonteCarloOptions options;
+  options.numberOfSamples = 1000;
+  ThreadPool single(1);
+  ThreadPool triple(3);
+  auto circuit = ExampleCircuitGenerator::getDividerCircuit();
+  MonteCarloResult a = MonteCarlo::run(circuit, tolerances, outputs, options, single);
+  MonteCarloResult b = MonteCarlo::run(circuit, tolerances, outputs, options, triple);
+  options.seed = 1;
+  MonteCarloResult c = MonteCarlo::run(circuit, tolerances, outputs, options, triple);
+  // Verify results.
+  EXPECT_EQ(a.numberOfPassedSamples, b.numberOfPassedSamples);
+  EXPECT_EQ(a.statistics[0].getHistogram(), b.statistics[0].getHistogram());
+  EXPECT_NEAR(a.statistics[0].getMean(), b.statistics[0].getMean(), 1e-12);
+  EXPECT_NEAR(a.statistics[0].getVariance(), b.statistics[0].getVariance(), 1e-12);
+  EXPECT_NE(a.statistics[0].getMean(), c.statistics[0].getMean());
+  // Gaussian deviations stay within the tolerance.
+  for (uint64_t sample = 0; sample < 1000; sample++) {
+    EXPECT_LE(std::abs(MonteCarlo::getDeviation(0, sample, 0, tolerances[0])), 0.1);
+  }
+}
+
+/// @brief Test that Gaussian deviations are truncated, not clamped, at the tolerance.
+TEST(monte_carlo, gaussian_truncation) {
+  // Draw many deviations of a 10 % Gaussian tolerance.
+  const ComponentTolerance tolerance = {1, 0.1, ToleranceDistribution::GAUSSIAN};
+  RunningStatistics statistics(-0.1, 0.1, 20);
+  uint64_t atLimit = 0;
+  for (uint64_t sample = 0; sample < 100000; sample++) {
+    const double deviation = MonteCarlo::getDeviation(3, sample, 0, tolerance);
+    statistics.add(deviation);
+    atLimit += std::abs(deviation) >= 0.1 ? 1 : 0;
+  }
+  // Verify results. Clamping would put about 270 draws exactly on the limits. The outermost
+  // bins of a truncated Gaussian hold about 0.2 % of the draws, less than their neighbours.
+  EXPECT_EQ(atLimit, 0);
+  EXPECT_NEAR(statistics.getMean(), 0.0, 1e-3);
+  EXPECT_NEAR(std::sqrt(statistics.getVariance()), 0.1 / 3.0 * 0.986, 5e-4);
+  const std::vector<uint64_t> &histogram = statistics.getHistogram();
+  EXPECT_LT(histogram.front(), histogram[1]);
+  EXPECT_LT(histogram.back(), histogram[histogram.size() - 2]);
+}
+
+/// @brief Test that invalid settings are rejected.
+TEST(monte_carlo, rejects_invalid_input) {
+  // Set up.
+  ThreadPool pool(2);
+  auto circuit = ExampleCircuitGenerator::getDividerCircuit();
+  std::vector<MonteCarloOutput> outputs = {{2}};
+  MonteCarloOptions options;
+  options.numberOfSamples = 10;
+  // Verify results.
+  EXPECT_THROW(MonteCarlo::run(circuit, {{99, 0.05}}, outputs, options, pool), std::runtime_error);
+  EXPECT_THROW(MonteCarlo::run(circuit, {{3, 1.5}}, outputs, options, pool), std::runtime_error);
+  EXPECT_THROW(MonteCarlo::run(circuit, {{3, 0.1}, {3, 0.2}}, outputs, options, pool),
+               std::runtime_error);
+  EXPECT_THROW(MonteCarlo::run(circuit, {{1, 0.1}}, outputs, options, pool), std::runtime_error);
+  EXPECT_THROW(MonteCarlo::run(circuit, {}, {}, options, pool), std::runtime_error);
+  EXPECT_THROW(MonteCarlo::run(circuit, {}, {{42}}, options, pool), std::runtime_error);
+  auto transientCircuit = ExampleCircuitGenerator::getDividerCircuit(SimulationMode::TRANSIENT);
+  EXPECT_THROW(MonteCarlo::run(transientCircuit, {}, outputs, options, pool), std::runtime_error);
+}
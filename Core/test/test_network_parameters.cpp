@@ -0,0 +1,150 @@
+//==============================================================================
+// File:        test_network_parameters.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for NetworkParameters class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover NetworkParameters class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=network_parameters.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "network_parameters.hpp"
+#include "thread_pool.hpp"
+#include <armadillo>
+#include <cmath>
+#include <complex>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+
+namespace {
+
+/// @brief Resistive pi network: 100 ohm from bus 1 and bus 2 to ground, 50 ohm between them,
+/// and a current source at bus 1, which the parameters must ignore. Port 1 is bus 1, port 2 is
+/// bus 2, both against ground.
+std::shared_ptr<Circuit> makePiNetwork() {
+  CircuitBuilder builder(SimulationMode::AC);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 2, 100, 1, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 3, 50, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 4, 100, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::AC_CURRENT_SOURCE, 5, 1, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+  });
+  std::shared_ptr<Circuit> circuit = builder.build();
+  circuit->setPorts({{1, 0}, {2, 0}});
+  return circuit;
+}
+
+} // namespace
+
+/// @brief Test the Z and Y parameters of a pi network against hand calculation.
+TEST(network_parameters, pi_network_impedance_and_admittance) {
+  // Y11 = Y22 = 1 / 100 + 1 / 50, Y12 = Y21 = -1 / 50, and Z = Y^-1.
+  auto circuit = makePiNetwork();
+  NetworkParameterResult z =
+      NetworkParameters::compute(circuit, {1000.0f}, NetworkParameterType::IMPEDANCE, 1);
+  NetworkParameterResult y =
+      NetworkParameters::compute(circuit, {1000.0f}, NetworkParameterType::ADMITTANCE, 1);
+  // Verify results. Entry (i, j) is row i + 2 * j.
+  ASSERT_EQ(z.parameters.n_rows, 4);
+  ASSERT_EQ(z.parameters.n_cols, 1);
+  EXPECT_NEAR(z.parameters(0, 0).real(), 60.0, 1e-5);
+  EXPECT_NEAR(z.parameters(1, 0).real(), 40.0, 1e-5);
+  EXPECT_NEAR(z.parameters(2, 0).real(), 40.0, 1e-5);
+  EXPECT_NEAR(z.parameters(3, 0).real(), 60.0, 1e-5);
+  EXPECT_NEAR(y.parameters(0, 0).real(), 0.03, 1e-9);
+  EXPECT_NEAR(y.parameters(1, 0).real(), -0.02, 1e-9);
+  EXPECT_NEAR(y.parameters(2, 0).real(), -0.02, 1e-9);
+  EXPECT_NEAR(y.parameters(3, 0).real(), 0.03, 1e-9);
+}
+
+/// @brief Test the S parameters of the pi network against the two-port conversion formulas.
+TEST(network_parameters, pi_network_scattering) {
+  // With Z0 = 50: D = (Z11 + Z0) * (Z22 + Z0) - Z12 * Z21,
+  // S11 = ((Z11 - Z0) * (Z22 + Z0) - Z12 * Z21) / D and S21 = 2 * Z21 * Z0 / D.
+  NetworkParameterResult s = NetworkParameters::compute(makePiNetwork(), {1000.0f},
+                                                        NetworkParameterType::SCATTERING, 1);
+  // Verify results.
+  const double d = 110.0 * 110.0 - 40.0 * 40.0;
+  const double s11 = (10.0 * 110.0 - 40.0 * 40.0) / d;
+  const double s21 = 2.0 * 40.0 * 50.0 / d;
+  EXPECT_NEAR(s.parameters(0, 0).real(), s11, 1e-6);
+  EXPECT_NEAR(s.parameters(1, 0).real(), s21, 1e-6);
+  EXPECT_NEAR(s.parameters(2, 0).real(), s21, 1e-6);
+  EXPECT_NEAR(s.parameters(3, 0).real(), s11, 1e-6);
+}
+
+/// @brief Test a one-port RC load over several frequencies on several threads.
+TEST(network_parameters, rc_frequency_points) {
+  // 50 ohm in parallel with 1 uF at bus 1, port 1 against ground.
+  CircuitBuilder builder(SimulationMode::AC);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 2, 50, 1, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::CAPACITOR, 3, 1e-6f, 1, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  std::shared_ptr<Circuit> circuit = builder.build();
+  circuit->setPorts({{1, 0, 50.0}});
+  const std::vector<float> frequencies = {1.0f, 100.0f, 1e3f, 1e4f, 1e5f, 1e6f};
+  ThreadPool pool(3);
+  NetworkParameterResult z =
+      NetworkParameters::compute(circuit, frequencies, NetworkParameterType::IMPEDANCE, pool);
+  NetworkParameterResult s =
+      NetworkParameters::compute(circuit, frequencies, NetworkParameterType::SCATTERING, pool);
+  // Verify results. At low frequencies the load is matched, at high ones it is a short.
+  ASSERT_EQ(z.parameters.n_cols, frequencies.size());
+  const double pi = std::acos(-1.0);
+  for (size_t k = 0; k < frequencies.size(); k++) {
+    const std::complex<double> admittance(1.0 / 50.0, 2.0 * pi * frequencies[k] * 1e-6);
+    EXPECT_NEAR(std::abs(z.parameters(0, k) - 1.0 / admittance), 0.0, 1e-4);
+    const std::complex<double> reflection = (1.0 / admittance - 50.0) / (1.0 / admittance + 50.0);
+    EXPECT_NEAR(std::abs(s.parameters(0, k) - reflection), 0.0, 1e-6);
+  }
+  EXPECT_NEAR(std::abs(s.parameters(0, 0)), 0.0, 1e-3);
+  EXPECT_GT(std::abs(s.parameters(0, 5)), 0.99);
+}
+
+/// @brief Test that circuits without valid ports are rejected.
+TEST(network_parameters, rejects_invalid_ports) {
+  // Verify results.
+  auto circuit = makePiNetwork();
+  const auto type = NetworkParameterType::IMPEDANCE;
+  EXPECT_THROW(NetworkParameters::compute(circuit, {}, type, 1), std::runtime_error);
+  circuit->setPorts({});
+  EXPECT_THROW(NetworkParameters::compute(circuit, {1e3f}, type, 1), std::runtime_error);
+  circuit->setPorts({{1, 42}});
+  EXPECT_THROW(NetworkParameters::compute(circuit, {1e3f}, type, 1), std::runtime_error);
+  circuit->setPorts({{1, 1}});
+  EXPECT_THROW(NetworkParameters::compute(circuit, {1e3f}, type, 1), std::runtime_error);
+  circuit->setPorts({{1, 0, 0.0}});
+  EXPECT_THROW(NetworkParameters::compute(circuit, {1e3f}, type, 1), std::runtime_error);
+  circuit->setPorts({{1, 0}});
+  circuit->setSimulationMode(SimulationMode::DC);
+  EXPECT_THROW(NetworkParameters::compute(circuit, {1e3f}, type, 1), std::runtime_error);
+}
@@ -0,0 +1,112 @@
+//==============================================================================
+// File:        test_nonlinear_solver.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for NonlinearSolver class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover NonlinearSolver class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=nonlinear_solver.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include "diode.hpp"
+#include "example_circuit_generator.hpp"
+#include "nonlinear_solver.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::test::helpers;
+
+/// @brief Test the operating point of a forward biased diode.
+TEST(nonlinear_solver, forward_biased_diode) {
+  // Solve.
+  NewtonResult result = NonlinearSolver::solve(ExampleCircuitGenerator::getDiodeCircuit());
+  // Verify results: the resistor current equals the diode current.
+  ASSERT_TRUE(result.converged);
+  const double voltage = result.solution(result.busIdMap.at(2) - 1);
+  const Diode diode(4, 1e-14f);
+  EXPECT_GT(voltage, 0.6);
+  EXPECT_LT(voltage, 0.8);
+  EXPECT_NEAR((5.0 - voltage) / 1000.0, diode.getCurrent(voltage), 1e-9);
+  ASSERT_EQ(result.diodeIds.size(), 1);
+  EXPECT_NEAR(result.diodeCurrents[0], (5.0 - voltage) / 1000.0, 1e-9);
+  EXPECT_LT(result.iterations, 30);
+  EXPECT_LE(result.numberOfFactorizations, result.iterations);
+}
+
+/// @brief Test a forward and a reverse biased diode, where the settled one is bypassed.
+TEST(nonlinear_solver, bypasses_settled_diodes) {
+  // Bus 2 is clamped by two diodes in series to ground. Bus 4 sits behind a reverse biased
+  // diode and a 1 kohm resistor to ground.
+  CircuitBuilder builder(SimulationMode::DC);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::DIODE, 4, 1e-14f, 2, 3, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::DIODE, 5, 1e-14f, 3, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::DIODE, 6, 1e-14f, 4, 1, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 7, 1000, 4, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  NewtonResult result = NonlinearSolver::solve(builder.build());
+  // Verify results.
+  ASSERT_TRUE(result.converged);
+  const double top = result.solution(result.busIdMap.at(2) - 1);
+  const double middle = result.solution(result.busIdMap.at(3) - 1);
+  const double blocked = result.solution(result.busIdMap.at(4) - 1);
+  const Diode diode(4, 1e-14f);
+  EXPECT_NEAR(top, 2.0 * middle, 1e-6);
+  EXPECT_NEAR((10.0 - top) / 1000.0, diode.getCurrent(middle), 1e-9);
+  // Only the leakage through the minimum conductance reaches bus 4.
+  EXPECT_NEAR(blocked, 10.0 * NonlinearSolver::MINIMUM_CONDUCTANCE * 1000.0, 1e-10);
+  EXPECT_NEAR(result.diodeCurrents[2], -1e-14, 1e-15);
+  EXPECT_GT(result.numberOfBypasses, 0);
+  EXPECT_EQ(result.numberOfEvaluations + result.numberOfBypasses, 3 * result.iterations);
+}
+
+/// @brief Test that diodes are rejected where they cannot be solved.
+TEST(nonlinear_solver, rejects_invalid_input) {
+  // Set up.
+  auto circuit = ExampleCircuitGenerator::getDiodeCircuit();
+  auto acCircuit = ExampleCircuitGenerator::getDiodeCircuit(SimulationMode::AC);
+  auto transientCircuit = ExampleCircuitGenerator::getDiodeCircuit(SimulationMode::TRANSIENT);
+  // Verify results.
+  ValidationOptions options;
+  EXPECT_FALSE(CircuitValidator::isValidCircuit(*acCircuit, options).isValid);
+  EXPECT_FALSE(CircuitValidator::isValidCircuit(*transientCircuit, options).isValid);
+  EXPECT_THROW(CircuitTransformer transformer(circuit), std::runtime_error);
+  EXPECT_THROW(NonlinearSolver::solve(acCircuit), std::runtime_error);
+  NewtonOptions newtonOptions;
+  newtonOptions.maxIterations = 0;
+  EXPECT_THROW(NonlinearSolver::solve(circuit, newtonOptions), std::runtime_error);
+  // Too few iterations are reported, not thrown.
+  newtonOptions.maxIterations = 2;
+  EXPECT_FALSE(NonlinearSolver::solve(circuit, newtonOptions).converged);
+}
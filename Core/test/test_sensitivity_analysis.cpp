@@ -0,0 +1,132 @@
+//==============================================================================
+// File:        test_sensitivity_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for SensitivityAnalysis class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover SensitivityAnalysis class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=sensitivity_analysis.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_snapshot.hpp"
+#include "circuit_transformer.hpp"
+#include "sensitivity_analysis.hpp"
+#include <armadillo>
+#include <complex>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+
+/// @brief Test the sensitivities of a DC voltage divider against the closed form.
+TEST(sensitivity_analysis, dc_divider) {
+  // 10 V across R1 = R2 = 1 kohm, output at bus 2.
+  CircuitBuilder builder(SimulationMode::DC);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 4, 1000, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  SensitivityResult result = SensitivityAnalysis::compute(builder.build(), {2, 0});
+  // Verify results: v = 10 * R2 / (R1 + R2).
+  ASSERT_EQ(result.componentIds, (std::vector<ComponentId>{2, 3, 4}));
+  EXPECT_NEAR(result.voltages(0).real(), 5.0, 1e-6);
+  EXPECT_NEAR(result.sensitivities(0, 0).real(), 0.5, 1e-9);
+  EXPECT_NEAR(result.sensitivities(0, 1).real(), -2.5e-3, 1e-9);
+  EXPECT_NEAR(result.sensitivities(0, 2).real(), 2.5e-3, 1e-9);
+  EXPECT_NEAR(result.magnitudeSensitivities(0, 1), -2.5e-3, 1e-9);
+  // Ground does not depend on anything.
+  EXPECT_EQ(result.voltages(1), std::complex<double>(0.0));
+  for (arma::uword m = 0; m < 3; m++) {
+    EXPECT_EQ(result.sensitivities(1, m), std::complex<double>(0.0));
+  }
+}
+
+/// @brief Test the sensitivities of an AC circuit against central finite differences.
+TEST(sensitivity_analysis, ac_finite_differences) {
+  // Source -> R -> C to ground -> L -> R to ground, with a current source at the load.
+  CircuitBuilder builder(SimulationMode::AC);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::AC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE, 20},
+      {ComponentType::RESISTOR, 3, 100, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::CAPACITOR, 4, 1e-6f, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::INDUCTOR, 5, 1e-2f, 2, 3, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 6, 50, 3, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::AC_CURRENT_SOURCE, 7, 0.02f, 0, 3, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE, -45},
+  });
+  std::shared_ptr<Circuit> circuit = builder.build();
+  circuit->setFrequency(1000.0f);
+  const std::map<ComponentId, std::pair<float, float>> values = {
+      {2, {10.0f, 20.0f}}, {3, {100.0f, 0.0f}}, {4, {1e-6f, 0.0f}},
+      {5, {1e-2f, 0.0f}},  {6, {50.0f, 0.0f}},  {7, {0.02f, -45.0f}}};
+  SensitivityResult result = SensitivityAnalysis::compute(circuit, {2, 3});
+  // Verify results. Sensitivities are scaled by the value, so that all are in volts.
+  const CircuitSnapshot base(circuit);
+  auto solve = [&](ComponentId id, float value) {
+    CircuitTransformer transformer(base.withComponentValue(id, value, values.at(id).second));
+    return CircuitFactorization(*transformer.getAdmittanceMatrix())
+        .solve(*transformer.getCurrentVector());
+  };
+  ASSERT_EQ(result.componentIds.size(), 6);
+  for (size_t m = 0; m < result.componentIds.size(); m++) {
+    const ComponentId id = result.componentIds[m];
+    const float value = values.at(id).first;
+    const arma::cx_vec up = solve(id, value * 1.01f);
+    const arma::cx_vec down = solve(id, value * 0.99f);
+    for (size_t k = 0; k < 2; k++) {
+      const std::complex<double> expected = (up(k + 1) - down(k + 1)) / 0.02;
+      EXPECT_LT(std::abs(result.sensitivities(k, m) * double(value) - expected), 1e-3)
+          << "component " << id << ", bus " << k + 2;
+    }
+  }
+}
+
+/// @brief Test that invalid input is rejected.
+TEST(sensitivity_analysis, rejects_invalid_input) {
+  // Set up.
+  CircuitBuilder builder(SimulationMode::TRANSIENT);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_CURRENT_SOURCE, 2, 1, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 10, 1, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  std::shared_ptr<Circuit> circuit = builder.build();
+  // Verify results.
+  EXPECT_THROW(SensitivityAnalysis::compute(circuit, {1}), std::runtime_error);
+  circuit->setSimulationMode(SimulationMode::DC);
+  EXPECT_THROW(SensitivityAnalysis::compute(circuit, {9}), std::runtime_error);
+  EXPECT_NEAR(SensitivityAnalysis::compute(circuit, {1}).sensitivities(0, 0).real(), 10.0, 1e-5);
+}
@@ -0,0 +1,92 @@
+//==============================================================================
+// File:        test_solution_cache.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for SolutionCache class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover SolutionCache class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=solution_cache.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "component.hpp"
+#include "dc_current_source.hpp"
+#include "example_circuit_generator.hpp"
+#include "solution_cache.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::test::helpers;
+
+/// @brief Test that an identical circuit is answered from the cache.
+TEST(solution_cache, identical_circuit_hits) {
+  // Solve the same circuit twice.
+  SolutionCache cache(4, 4);
+  auto first = cache.solve(ExampleCircuitGenerator::getExampleCircuit1());
+  auto second = cache.solve(ExampleCircuitGenerator::getExampleCircuit1());
+  // Verify results.
+  EXPECT_EQ(first, second);
+  EXPECT_FLOAT_EQ((*first)(0).real(), 200.0f);
+  EXPECT_EQ(cache.getSolutionStatistics().hits, 1);
+  EXPECT_EQ(cache.getSolutionStatistics().misses, 1);
+  EXPECT_EQ(cache.getFactorizationStatistics().misses, 1);
+}
+
+/// @brief Test that a circuit with different source values reuses the factorization.
+TEST(solution_cache, source_change_reuses_factorization) {
+  // Solve circuit 1, then the same circuit with a 2 A source.
+  SolutionCache cache(4, 4);
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit1();
+  cache.solve(circuit);
+  std::static_pointer_cast<DCCurrentSource>(circuit->getComponents().at(0))->setAmps(2.0f);
+  auto solution = cache.solve(circuit);
+  // Verify results.
+  EXPECT_FLOAT_EQ((*solution)(0).real(), 400.0f);
+  EXPECT_EQ(cache.getSolutionStatistics().hits, 0);
+  EXPECT_EQ(cache.getSolutionStatistics().misses, 2);
+  EXPECT_EQ(cache.getFactorizationStatistics().hits, 1);
+}
+
+/// @brief Test that old solutions are evicted.
+TEST(solution_cache, evicts_old_solutions) {
+  // Solve three different circuits with room for two solutions.
+  SolutionCache cache(2, 2);
+  cache.solve(ExampleCircuitGenerator::getExampleCircuit1());
+  cache.solve(ExampleCircuitGenerator::getExampleCircuit2());
+  cache.solve(ExampleCircuitGenerator::getExampleCircuit3());
+  cache.solve(ExampleCircuitGenerator::getExampleCircuit1());
+  // Verify results.
+  EXPECT_EQ(cache.getSolutionStatistics().hits, 0);
+  EXPECT_EQ(cache.getSolutionStatistics().evictions, 2);
+}
+
+/// @brief Test that invalid circuits are rejected and not cached.
+TEST(solution_cache, invalid_circuit) {
+  // Solve an empty circuit.
+  SolutionCache cache(2, 2);
+  // Verify results.
+  EXPECT_THROW(cache.solve(std::make_shared<Circuit>()), std::runtime_error);
+  EXPECT_EQ(cache.getSolutionStatistics().hits, 0);
+}
@@ -0,0 +1,171 @@
+//==============================================================================
+// File:        test_subcircuit.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for subcircuit classes in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover SubcircuitDefinition and SubcircuitInstance classes.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=subcircuit.*
+//==============================================================================
+
+#include "bus.hpp"
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_calculator.hpp"
+#include "circuit_structs.hpp"
+#include "circuit_transformer.hpp"
+#include "circuit_validator.hpp"
+#include "connection_manager.hpp"
+#include "dc_voltage_source.hpp"
+#include "resistor.hpp"
+#include "subcircuit.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::managers;
+
+/// @brief Creates a cell of two 100 ohm resistors in series: port 1 - bus 3 - port 2.
+static std::shared_ptr<const SubcircuitDefinition> createSeriesCell() {
+  auto in = std::make_shared<Bus>(1);
+  auto out = std::make_shared<Bus>(2);
+  auto middle = std::make_shared<Bus>(3);
+  auto r1 = std::make_shared<Resistor>(1, 100);
+  auto r2 = std::make_shared<Resistor>(2, 100);
+  ConnectionManager::connectBusAndComponent(in, r1, TerminalRole::NEGATIVE);
+  ConnectionManager::connectBusAndComponent(middle, r1, TerminalRole::POSITIVE);
+  ConnectionManager::connectBusAndComponent(middle, r2, TerminalRole::NEGATIVE);
+  ConnectionManager::connectBusAndComponent(out, r2, TerminalRole::POSITIVE);
+  return std::make_shared<const SubcircuitDefinition>(
+      std::vector<std::shared_ptr<Bus>>{in, out, middle},
+      std::vector<std::shared_ptr<Component>>{r1, r2}, std::vector<BusId>{1, 2});
+}
+
+/// @brief Creates a DC circuit with a 1 A source from ground (bus 1) into bus 2 and a free bus 3.
+static std::shared_ptr<Circuit> createParentCircuit() {
+  CircuitBuilder builder;
+  builder.addBus(1);
+  builder.addBus(2);
+  builder.addBus(3);
+  builder.addComponent(
+      {ComponentType::GROUND, 1, 0, 1, 1, TerminalRole::NEGATIVE, TerminalRole::NEGATIVE});
+  builder.addComponent({ComponentType::DC_CURRENT_SOURCE, 2, 1, 1, 2, TerminalRole::NEGATIVE,
+                        TerminalRole::POSITIVE});
+  return builder.build();
+}
+
+/// @brief Test that the local indices put ports first.
+TEST(subcircuit, local_indices) {
+  // Create definition.
+  auto cell = createSeriesCell();
+  // Verify results.
+  EXPECT_EQ(cell->getNumberOfPorts(), 2);
+  EXPECT_EQ(cell->getNumberOfInternalBuses(), 1);
+  EXPECT_EQ(cell->getLocalIndex(1), 0);
+  EXPECT_EQ(cell->getLocalIndex(2), 1);
+  EXPECT_EQ(cell->getLocalIndex(3), 2);
+  EXPECT_EQ(cell->getPortGroups().at(0), cell->getPortGroups().at(1));
+  EXPECT_THROW(cell->getLocalIndex(4), std::runtime_error);
+}
+
+/// @brief Test that two instances of a cell solve like the flattened circuit.
+TEST(subcircuit, instances_solve_like_flat_circuit) {
+  // Place two series cells between bus 2 and ground: 400 ohm in total.
+  auto circuit = createParentCircuit();
+  auto cell = createSeriesCell();
+  circuit->setSubcircuitInstances({std::make_shared<const SubcircuitInstance>(
+                                       1, cell, std::vector<BusId>{2, 3}),
+                                   std::make_shared<const SubcircuitInstance>(
+                                       2, cell, std::vector<BusId>{3, 1})});
+  // Transform and solve.
+  CircuitTransformer transformer(circuit);
+  auto solution = CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                                   transformer.getCurrentVector());
+  // Verify results.
+  EXPECT_TRUE(CircuitValidator::isValidCircuit(*circuit).isValid);
+  EXPECT_EQ(transformer.getNumberOfSubcircuitStamps(), 1);
+  ASSERT_EQ(solution->n_elem, 4);
+  BusNumber bus2 = transformer.getBusIdMap().at(2);
+  BusNumber bus3 = transformer.getBusIdMap().at(3);
+  BusNumber middle1 = transformer.getSubcircuitBusNumber(0, 3);
+  BusNumber middle2 = transformer.getSubcircuitBusNumber(1, 3);
+  EXPECT_EQ(transformer.getSubcircuitBusNumber(1, 2), 0);
+  EXPECT_NEAR((*solution)(bus2 - 1).real(), 400.0, 1e-3);
+  EXPECT_NEAR((*solution)(middle1 - 1).real(), 300.0, 1e-3);
+  EXPECT_NEAR((*solution)(bus3 - 1).real(), 200.0, 1e-3);
+  EXPECT_NEAR((*solution)(middle2 - 1).real(), 100.0, 1e-3);
+}
+
+/// @brief Test that definitions reject unsupported contents and unknown ports.
+TEST(subcircuit, invalid_definitions) {
+  // Create buses and components.
+  auto a = std::make_shared<Bus>(1);
+  auto b = std::make_shared<Bus>(2);
+  auto source = std::make_shared<DCVoltageSource>(1, 5);
+  auto resistor = std::make_shared<Resistor>(2, 10);
+  ConnectionManager::connectBusAndComponent(a, source, TerminalRole::NEGATIVE);
+  ConnectionManager::connectBusAndComponent(b, source, TerminalRole::POSITIVE);
+  ConnectionManager::connectBusAndComponent(a, resistor, TerminalRole::NEGATIVE);
+  // Verify results.
+  EXPECT_THROW(SubcircuitDefinition({a, b}, {source}, {1, 2}), std::runtime_error);
+  EXPECT_THROW(SubcircuitDefinition({a, b}, {resistor}, {1, 2}), std::runtime_error);
+  EXPECT_THROW(SubcircuitDefinition({a, b}, {}, {1, 3}), std::runtime_error);
+  EXPECT_THROW(SubcircuitDefinition({a, b}, {}, {1, 1}), std::runtime_error);
+}
+
+/// @brief Test that an instance must map every port.
+TEST(subcircuit, instance_port_count_must_match) {
+  // Create definition.
+  auto cell = createSeriesCell();
+  // Verify results.
+  EXPECT_THROW(SubcircuitInstance(1, cell, {2}), std::runtime_error);
+  EXPECT_THROW(SubcircuitInstance(1, nullptr, {}), std::runtime_error);
+}
+
+/// @brief Test that the validator follows connections through the inside of instances.
+TEST(subcircuit, validator_uses_port_groups) {
+  // Create a definition whose two ports are not connected to each other.
+  auto a = std::make_shared<Bus>(1);
+  auto b = std::make_shared<Bus>(2);
+  auto c = std::make_shared<Bus>(3);
+  auto r1 = std::make_shared<Resistor>(1, 10);
+  auto r2 = std::make_shared<Resistor>(2, 10);
+  ConnectionManager::connectBusAndComponent(a, r1, TerminalRole::NEGATIVE);
+  ConnectionManager::connectBusAndComponent(c, r1, TerminalRole::POSITIVE);
+  ConnectionManager::connectBusAndComponent(b, r2, TerminalRole::NEGATIVE);
+  ConnectionManager::connectBusAndComponent(c, r2, TerminalRole::POSITIVE);
+  auto open = std::make_shared<const SubcircuitDefinition>(
+      std::vector<std::shared_ptr<Bus>>{a, b, c}, std::vector<std::shared_ptr<Component>>{r1},
+      std::vector<BusId>{1, 2});
+  // Place it between bus 2 and bus 3 of the parent circuit.
+  auto circuit = createParentCircuit();
+  circuit->setSubcircuitInstances(
+      {std::make_shared<const SubcircuitInstance>(1, open, std::vector<BusId>{2, 3})});
+  ValidationResult result = CircuitValidator::isValidCircuit(*circuit);
+  // Verify results.
+  EXPECT_NE(open->getPortGroups().at(0), open->getPortGroups().at(1));
+  EXPECT_FALSE(result.isValid);
+  ASSERT_EQ(result.errors.size(), 1);
+  EXPECT_EQ(result.errors.at(0).code, ValidationErrorCode::CIRCUIT_NOT_FULLY_CONNECTED);
+}
@@ -0,0 +1,124 @@
+//==============================================================================
+// File:        test_superposition_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for SuperpositionAnalysis class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover SuperpositionAnalysis class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=superposition_analysis.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_calculator.hpp"
+#include "circuit_transformer.hpp"
+#include "superposition_analysis.hpp"
+#include <armadillo>
+#include <complex>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+
+namespace {
+
+/// @brief 10 V -> 1 kohm -> bus 2, which has 1 kohm to ground and 1 mA injected.
+std::shared_ptr<Circuit> makeTwoSourceCircuit() {
+  CircuitBuilder builder;
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 4, 1000, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::DC_CURRENT_SOURCE, 5, 1e-3f, 0, 2, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+  });
+  return builder.build();
+}
+
+} // namespace
+
+/// @brief Test the contributions of two DC sources against hand calculation.
+TEST(superposition_analysis, dc_contributions) {
+  // Decompose all buses.
+  SuperpositionResult result = SuperpositionAnalysis::compute(makeTwoSourceCircuit());
+  // Verify results. Buses are 0, 1 and 2, sources 2 and 5.
+  ASSERT_EQ(result.sourceIds, (std::vector<ComponentId>{2, 5}));
+  ASSERT_EQ(result.busIds, (std::vector<BusId>{0, 1, 2}));
+  ASSERT_EQ(result.contributions.n_rows, 2);
+  ASSERT_EQ(result.contributions.n_cols, 3);
+  EXPECT_EQ(result.contributions(0, 0), std::complex<double>(0.0));
+  EXPECT_EQ(result.contributions(1, 0), std::complex<double>(0.0));
+  EXPECT_NEAR(result.contributions(0, 1).real(), 10.0, 1e-6);
+  EXPECT_NEAR(std::abs(result.contributions(1, 1)), 0.0, 1e-9);
+  EXPECT_NEAR(result.contributions(0, 2).real(), 5.0, 1e-6);
+  EXPECT_NEAR(result.contributions(1, 2).real(), 0.5, 1e-6);
+}
+
+/// @brief Test that a subset of buses, solved with transposed solves, gives the same values.
+TEST(superposition_analysis, bus_subset) {
+  // One bus and two sources select the transposed solves.
+  auto circuit = makeTwoSourceCircuit();
+  SuperpositionResult all = SuperpositionAnalysis::compute(circuit);
+  SuperpositionResult subset = SuperpositionAnalysis::compute(circuit, {2});
+  // Verify results.
+  ASSERT_EQ(subset.contributions.n_rows, 2);
+  ASSERT_EQ(subset.contributions.n_cols, 1);
+  for (arma::uword m = 0; m < 2; m++) {
+    EXPECT_NEAR(std::abs(subset.contributions(m, 0) - all.contributions(m, 2)), 0.0, 1e-9);
+  }
+  EXPECT_THROW(SuperpositionAnalysis::compute(circuit, {42}), std::runtime_error);
+}
+
+/// @brief Test that the contributions of AC sources add up to the full solution.
+TEST(superposition_analysis, ac_sum_matches_solution) {
+  // Source -> R -> C to ground -> L -> R to ground, with a current source at the load.
+  CircuitBuilder builder(SimulationMode::AC);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::AC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE, 20},
+      {ComponentType::RESISTOR, 3, 100, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::CAPACITOR, 4, 1e-6f, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::INDUCTOR, 5, 1e-2f, 2, 3, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 6, 50, 3, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::AC_CURRENT_SOURCE, 7, 0.02f, 0, 3, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE, -45},
+  });
+  std::shared_ptr<Circuit> circuit = builder.build();
+  circuit->setFrequency(1000.0f);
+  SuperpositionResult result = SuperpositionAnalysis::compute(circuit, {1, 2, 3});
+  CircuitTransformer transformer(circuit);
+  arma::cx_vec x = *CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                                     transformer.getCurrentVector());
+  // Verify results. Bus k has matrix index k - 1.
+  for (arma::uword k = 0; k < 3; k++) {
+    const std::complex<double> sum = result.contributions(0, k) + result.contributions(1, k);
+    EXPECT_NEAR(std::abs(sum - x(k)), 0.0, 1e-9);
+  }
+  // The shorted voltage source keeps the current source away from bus 1.
+  EXPECT_NEAR(std::abs(result.contributions(1, 0)), 0.0, 1e-12);
+  EXPECT_GT(std::abs(result.contributions(1, 2)), 0.0);
+}
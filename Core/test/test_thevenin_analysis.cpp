@@ -0,0 +1,146 @@
+//==============================================================================
+// File:        test_thevenin_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for TheveninAnalysis class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover TheveninAnalysis class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=thevenin_analysis.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_factorization.hpp"
+#include "circuit_transformer.hpp"
+#include "thevenin_analysis.hpp"
+#include <armadillo>
+#include <complex>
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+
+namespace {
+
+/// @brief Source -> R -> C to ground -> L -> R to ground, optionally loaded at bus 3.
+std::shared_ptr<Circuit> makeAcCircuit(bool isLoaded) {
+  std::vector<ComponentDescriptor> descriptors = {
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::AC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE, 20},
+      {ComponentType::RESISTOR, 3, 100, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::CAPACITOR, 4, 1e-6f, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::INDUCTOR, 5, 1e-2f, 2, 3, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 6, 50, 3, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  };
+  if (isLoaded) {
+    descriptors.push_back(
+        {ComponentType::RESISTOR, 7, 75, 3, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE});
+  }
+  CircuitBuilder builder(SimulationMode::AC);
+  builder.addComponents(descriptors);
+  std::shared_ptr<Circuit> circuit = builder.build();
+  circuit->setFrequency(1000.0f);
+  return circuit;
+}
+
+} // namespace
+
+/// @brief Test the equivalents of a DC voltage divider against hand calculation.
+TEST(thevenin_analysis, dc_divider) {
+  // 10 V across two 1 kohm resistors.
+  CircuitBuilder builder;
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 4, 1000, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  TheveninResult result = TheveninAnalysis::compute(builder.build(), {{2, 0}, {2, 1}});
+  // Verify results. The source is shorted, so both pairs see the two resistors in parallel.
+  ASSERT_EQ(result.theveninVoltages.n_elem, 2);
+  EXPECT_NEAR(result.theveninVoltages(0).real(), 5.0, 1e-6);
+  EXPECT_NEAR(result.theveninImpedances(0).real(), 500.0, 1e-4);
+  EXPECT_NEAR(result.nortonCurrents(0).real(), 10e-3, 1e-9);
+  EXPECT_NEAR(result.nortonAdmittances(0).real(), 2e-3, 1e-9);
+  EXPECT_NEAR(result.theveninVoltages(1).real(), -5.0, 1e-6);
+  EXPECT_NEAR(result.theveninImpedances(1).real(), 500.0, 1e-4);
+}
+
+/// @brief Test that the Thevenin equivalent predicts the voltage across a load.
+TEST(thevenin_analysis, ac_load_voltage) {
+  // Extract the equivalent at bus 3, then solve the circuit with 75 ohm connected there.
+  TheveninResult result = TheveninAnalysis::compute(makeAcCircuit(false), {{3, 0}});
+  auto loaded = makeAcCircuit(true);
+  CircuitTransformer transformer(loaded);
+  const arma::cx_vec x = CircuitFactorization(*transformer.getAdmittanceMatrix())
+                             .solve(*transformer.getCurrentVector());
+  // Verify results.
+  const std::complex<double> load = 75.0;
+  const std::complex<double> expected =
+      result.theveninVoltages(0) * load / (result.theveninImpedances(0) + load);
+  EXPECT_NEAR(std::abs(x(transformer.getBusIdMap().at(3) - 1) - expected), 0.0, 1e-6);
+  EXPECT_GT(result.theveninImpedances(0).imag(), 0.0);
+  EXPECT_NEAR(std::abs(result.nortonCurrents(0) * result.theveninImpedances(0) -
+                       result.theveninVoltages(0)),
+              0.0, 1e-9);
+}
+
+/// @brief Test that pairs across a voltage source or between two ground buses are shorts.
+TEST(thevenin_analysis, degenerate_pairs) {
+  // 10 V across two 1 kohm resistors, the lower one returning through a second ground bus.
+  CircuitBuilder builder;
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 10, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 4, 1000, 2, 5, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::GROUND, 5, 0, 5, 5, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+  });
+  TheveninResult result = TheveninAnalysis::compute(builder.build(), {{1, 0}, {0, 5}, {2, 5}});
+  // Verify results.
+  const double infinity = std::numeric_limits<double>::infinity();
+  EXPECT_NEAR(result.theveninVoltages(0).real(), 10.0, 1e-6);
+  EXPECT_EQ(result.theveninImpedances(0), std::complex<double>(0.0));
+  EXPECT_EQ(result.nortonCurrents(0).real(), infinity);
+  EXPECT_EQ(result.nortonAdmittances(0).real(), infinity);
+  EXPECT_EQ(result.theveninVoltages(1), std::complex<double>(0.0));
+  EXPECT_EQ(result.theveninImpedances(1), std::complex<double>(0.0));
+  EXPECT_EQ(result.nortonCurrents(1).real(), infinity);
+  EXPECT_EQ(result.nortonAdmittances(1).real(), infinity);
+  EXPECT_NEAR(result.theveninImpedances(2).real(), 500.0, 1e-4);
+}
+
+/// @brief Test that invalid pairs are rejected.
+TEST(thevenin_analysis, rejects_invalid_pairs) {
+  // Verify results.
+  EXPECT_THROW(TheveninAnalysis::compute(makeAcCircuit(false), {{3, 3}}), std::runtime_error);
+  EXPECT_THROW(TheveninAnalysis::compute(makeAcCircuit(false), {{3, 42}}), std::runtime_error);
+  TheveninResult empty = TheveninAnalysis::compute(makeAcCircuit(false), {});
+  EXPECT_EQ(empty.theveninVoltages.n_elem, 0);
+}
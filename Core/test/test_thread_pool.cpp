@@ -0,0 +1,116 @@
+//==============================================================================
+// File:        test_thread_pool.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for ThreadPool class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover ThreadPool class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=thread_pool.*
+//==============================================================================
+
+#include "thread_pool.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace ocira::core;
+
+/// @brief Test that every task of a batch runs exactly once.
+TEST(thread_pool, runs_every_task_once) {
+  // Create pool and run a batch.
+  ThreadPool pool(4);
+  std::vector<std::atomic<int>> counts(1000);
+  pool.run(counts.size(), [&counts](size_t index) { counts[index]++; });
+  // Verify results.
+  EXPECT_EQ(pool.getNumberOfThreads(), 4);
+  for (const std::atomic<int> &count : counts) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+/// @brief Test that the pool can run several batches.
+TEST(thread_pool, runs_several_batches) {
+  // Create pool and run batches.
+  ThreadPool pool(2);
+  std::atomic<int> total(0);
+  for (int batch = 0; batch < 10; batch++) {
+    pool.run(10, [&total](size_t) { total++; });
+  }
+  // Verify results.
+  EXPECT_EQ(total.load(), 100);
+}
+
+/// @brief Test that an exception thrown by a task reaches the caller.
+TEST(thread_pool, rethrows_task_exception) {
+  // Create pool.
+  ThreadPool pool(3);
+  std::atomic<int> finished(0);
+  // Verify results.
+  EXPECT_THROW(pool.run(8,
+                        [&finished](size_t index) {
+                          if (index == 5) {
+                            throw std::runtime_error("Task failed!");
+                          }
+                          finished++;
+                        }),
+               std::runtime_error);
+  EXPECT_EQ(finished.load(), 7);
+}
+
+/// @brief Test that ranges cover every item once, in one contiguous range per thread.
+TEST(thread_pool, runs_ranges) {
+  // Create pool and split 10 items and 2 items.
+  ThreadPool pool(4);
+  std::vector<std::atomic<int>> counts(10);
+  std::vector<std::atomic<int>> sizes(4);
+  pool.runRanges(counts.size(), [&](size_t task, size_t begin, size_t end) {
+    sizes[task] = static_cast<int>(end - begin);
+    for (size_t k = begin; k < end; k++) {
+      counts[k]++;
+    }
+  });
+  std::atomic<int> numberOfRanges(0);
+  pool.runRanges(2, [&numberOfRanges](size_t, size_t begin, size_t end) {
+    numberOfRanges += end - begin == 1 ? 1 : 0;
+  });
+  // Verify results.
+  for (const std::atomic<int> &count : counts) {
+    EXPECT_EQ(count.load(), 1);
+  }
+  for (const std::atomic<int> &size : sizes) {
+    EXPECT_GE(size.load(), 2);
+    EXPECT_LE(size.load(), 3);
+  }
+  EXPECT_EQ(pool.getNumberOfRanges(2), 2);
+  EXPECT_EQ(pool.getNumberOfRanges(100), 4);
+  EXPECT_EQ(numberOfRanges.load(), 2);
+  pool.runRanges(0, [](size_t, size_t, size_t) { FAIL(); });
+}
+
+/// @brief Test that zero threads selects the hardware thread count.
+TEST(thread_pool, default_thread_count) {
+  // Create pool.
+  ThreadPool pool;
+  // Verify results.
+  EXPECT_GE(pool.getNumberOfThreads(), 1);
+}
@@ -0,0 +1,195 @@
+//==============================================================================
+// File:        test_transient_analysis.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for TransientAnalysis class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover TransientAnalysis class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=transient_analysis.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_builder.hpp"
+#include "circuit_transformer.hpp"
+#include "example_circuit_generator.hpp"
+#include "transient_analysis.hpp"
+#include <armadillo>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+
+using namespace ocira::core;
+using namespace ocira::core::components;
+using namespace ocira::core::test::helpers;
+
+namespace {
+
+/// @brief 1 V step through 1 kohm into 1 uF (tau = 1 ms). Bus 1 is the source, bus 2 the
+/// capacitor.
+std::shared_ptr<Circuit> makeRcCircuit() {
+  CircuitBuilder builder(SimulationMode::TRANSIENT);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_VOLTAGE_SOURCE, 2, 1, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 1000, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::CAPACITOR, 4, 1e-6f, 2, 0, TerminalRole::POSITIVE,
+       TerminalRole::NEGATIVE},
+  });
+  return builder.build();
+}
+
+/// @brief Largest deviation of the capacitor voltage from 1 - exp(-t / tau).
+double getRcError(const TransientResult &result, arma::uword row) {
+  double error = 0.0;
+  for (size_t k = 0; k < result.times.size(); k++) {
+    const double expected = 1.0 - std::exp(-result.times[k] / 1e-3);
+    error = std::max(error, std::abs(result.solutions(row, k) - expected));
+  }
+  return error;
+}
+
+} // namespace
+
+/// @brief Test the RC step response with both integration methods.
+TEST(transient_analysis, rc_step_response) {
+  // Simulate five time constants.
+  auto circuit = makeRcCircuit();
+  TransientOptions options;
+  options.timeStep = 1e-5;
+  options.stopTime = 5e-3;
+  options.method = IntegrationMethod::TRAPEZOIDAL;
+  TransientResult trapezoidal = TransientAnalysis::run(circuit, options);
+  options.method = IntegrationMethod::BACKWARD_EULER;
+  TransientResult backwardEuler = TransientAnalysis::run(circuit, options);
+  // Verify results. Bus 2 is the second unknown.
+  ASSERT_EQ(trapezoidal.times.size(), 500);
+  EXPECT_DOUBLE_EQ(trapezoidal.times.back(), 5e-3);
+  EXPECT_LT(getRcError(trapezoidal, 1), 1e-4);
+  EXPECT_LT(getRcError(backwardEuler, 1), 5e-3);
+  EXPECT_LT(getRcError(trapezoidal, 1), getRcError(backwardEuler, 1));
+  // The source row carries the charging current, 1 mA at the start and leaving the source.
+  EXPECT_NEAR(trapezoidal.solutions(2, 0), -1e-3, 2e-5);
+}
+
+/// @brief Test the current build-up in an inductor fed by a current source.
+TEST(transient_analysis, rl_current_buildup) {
+  // 1 A into 10 ohm parallel to 10 mH (tau = 1 ms).
+  CircuitBuilder builder(SimulationMode::TRANSIENT);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::DC_CURRENT_SOURCE, 2, 1, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE},
+      {ComponentType::RESISTOR, 3, 10, 1, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::INDUCTOR, 4, 1e-2f, 1, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  TransientAnalysis analysis(builder.build(), 1e-5);
+  // Step to 2 ms.
+  for (int k = 0; k < 200; k++) {
+    analysis.step();
+  }
+  // Verify results: the voltage decays as 10 * exp(-t / tau).
+  EXPECT_EQ(analysis.getNumberOfSteps(), 200);
+  EXPECT_NEAR(analysis.getTime(), 2e-3, 1e-15);
+  EXPECT_NEAR(analysis.getSolution()(0), 10.0 * std::exp(-2.0), 1e-4);
+}
+
+/// @brief Test that an AC source follows amplitude * cos(2 * pi * f * t + phase).
+TEST(transient_analysis, ac_source_waveform) {
+  // 2 V, 30 degrees, 50 Hz across a 2:1 divider.
+  CircuitBuilder builder(SimulationMode::TRANSIENT);
+  builder.addComponents({
+      {ComponentType::GROUND, 1, 0, 0, 0, TerminalRole::POSITIVE, TerminalRole::POSITIVE},
+      {ComponentType::AC_VOLTAGE_SOURCE, 2, 2, 0, 1, TerminalRole::NEGATIVE,
+       TerminalRole::POSITIVE, 30},
+      {ComponentType::RESISTOR, 3, 100, 1, 2, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+      {ComponentType::RESISTOR, 4, 100, 2, 0, TerminalRole::POSITIVE, TerminalRole::NEGATIVE},
+  });
+  TransientOptions options;
+  options.timeStep = 1e-4;
+  options.stopTime = 2e-2;
+  TransientResult result = TransientAnalysis::run(builder.build(), options);
+  // Verify results.
+  const double pi = std::acos(-1.0);
+  for (size_t k = 0; k < result.times.size(); k++) {
+    const double expected = std::cos(2.0 * pi * 50.0 * result.times[k] + pi / 6.0);
+    EXPECT_NEAR(result.solutions(1, k), expected, 1e-5);
+  }
+}
+
+/// @brief Test that changing the step keeps the solution accurate and reuses factorizations.
+TEST(transient_analysis, set_time_step) {
+  // Alternate between two steps, with room for both factorizations.
+  TransientAnalysis analysis(makeRcCircuit(), 1e-5, IntegrationMethod::TRAPEZOIDAL, 2);
+  for (int k = 0; k < 10; k++) {
+    analysis.setTimeStep(k % 2 == 0 ? 2e-5 : 1e-5);
+    for (int n = 0; n < 10; n++) {
+      analysis.step();
+    }
+  }
+  // Verify results.
+  EXPECT_EQ(analysis.getNumberOfFactorizations(), 2);
+  EXPECT_NEAR(analysis.getTime(), 1.5e-3, 1e-15);
+  EXPECT_NEAR(analysis.getSolution()(1), 1.0 - std::exp(-1.5), 1e-4);
+  EXPECT_THROW(analysis.setTimeStep(-1e-5), std::runtime_error);
+}
+
+/// @brief Test that the adaptive run grows the step as the RC circuit settles.
+TEST(transient_analysis, adaptive_rc_run) {
+  // Simulate twenty time constants, starting with a tiny step.
+  AdaptiveTransientOptions options;
+  options.initialStep = 1e-7;
+  options.minStep = 1e-12;
+  options.maxStep = 1e-2;
+  options.stopTime = 2e-2;
+  options.relativeTolerance = 1e-4;
+  options.absoluteTolerance = 1e-7;
+  TransientResult result = TransientAnalysis::runAdaptive(makeRcCircuit(), options);
+  // Verify results. A fixed step of 1e-5 s needs 2000 steps.
+  ASSERT_FALSE(result.times.empty());
+  EXPECT_DOUBLE_EQ(result.times.back(), 2e-2);
+  EXPECT_LT(getRcError(result, 1), 5e-4);
+  EXPECT_LT(result.times.size(), 200);
+  // One factorization per power of two the step passes through.
+  EXPECT_LT(result.numberOfFactorizations, result.times.size() / 3);
+  for (size_t k = 1; k < result.times.size(); k++) {
+    EXPECT_GT(result.times[k], result.times[k - 1]);
+  }
+}
+
+/// @brief Test that circuits of other modes and invalid settings are rejected.
+TEST(transient_analysis, rejects_invalid_input) {
+  // Verify results.
+  EXPECT_THROW(TransientAnalysis(ExampleCircuitGenerator::getExampleCircuit3(), 1e-6),
+               std::runtime_error);
+  EXPECT_THROW(TransientAnalysis(makeRcCircuit(), 0.0), std::runtime_error);
+  EXPECT_THROW(CircuitTransformer transformer(makeRcCircuit()), std::runtime_error);
+  TransientOptions options;
+  options.stopTime = -1.0;
+  EXPECT_THROW(TransientAnalysis::run(makeRcCircuit(), options), std::runtime_error);
+  AdaptiveTransientOptions adaptiveOptions;
+  adaptiveOptions.minStep = 1e-6;
+  adaptiveOptions.initialStep = 1e-9;
+  EXPECT_THROW(TransientAnalysis::runAdaptive(makeRcCircuit(), adaptiveOptions),
+               std::runtime_error);
+}
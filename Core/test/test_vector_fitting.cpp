@@ -0,0 +1,141 @@
+//==============================================================================
+// File:        test_vector_fitting.cpp
+// Author:      Martin Vidjeskog
+// Created:     2026-10-19
+// Description: Unit tests for VectorFitting class in OCIRA core library.
+// License:     GNU General Public License v3.0
+//==============================================================================
+//
+// This file is part of OCIRA (core library).
+//
+// OCIRA is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// OCIRA is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+//==============================================================================
+// Notes:
+// - Tests cover VectorFitting class.
+// - Run with: ctest or ./core_tests or ./core_tests --gtest_filter=vector_fitting.*
+//==============================================================================
+
+#include "circuit.hpp"
+#include "circuit_calculator.hpp"
+#include "circuit_transformer.hpp"
+#include "example_circuit_generator.hpp"
+#include "frequency_sweep.hpp"
+#include "vector_fitting.hpp"
+#include <armadillo>
+#include <complex>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace ocira::core;
+using namespace ocira::core::test::helpers;
+
+namespace {
+
+constexpr double TWO_PI = 6.283185307179586;
+
+/// @brief Samples two responses with a real pole and a conjugate pair.
+FrequencySweepResult makeSyntheticSweep(const arma::cx_vec &poles) {
+  const std::complex<double> residues[2][3] = {{{300.0, 0.0}, {1000.0, 500.0}, {1000.0, -500.0}},
+                                               {{-50.0, 0.0}, {20.0, -80.0}, {20.0, 80.0}}};
+  const double constants[2] = {0.5, -0.1};
+  FrequencySweepResult sweep;
+  sweep.frequencies = FrequencySweep::logarithmicPoints(1.0f, 1.0e4f, 100);
+  sweep.solutions.set_size(2, sweep.frequencies.size());
+  for (size_t k = 0; k < sweep.frequencies.size(); k++) {
+    const std::complex<double> s(0.0, TWO_PI * sweep.frequencies[k]);
+    for (arma::uword m = 0; m < 2; m++) {
+      std::complex<double> value = constants[m];
+      for (arma::uword n = 0; n < 3; n++) {
+        value += residues[m][n] / (s - poles(n));
+      }
+      sweep.solutions(m, k) = value;
+    }
+  }
+  return sweep;
+}
+
+} // namespace
+
+/// @brief Test that the poles of a rational function are recovered.
+TEST(vector_fitting, recovers_known_poles) {
+  // Sample a known model and fit it with the same order.
+  arma::cx_vec poles = {{-TWO_PI * 50.0, 0.0},
+                        {-TWO_PI * 100.0, TWO_PI * 1000.0},
+                        {-TWO_PI * 100.0, -TWO_PI * 1000.0}};
+  FrequencySweepResult sweep = makeSyntheticSweep(poles);
+  VectorFittingOptions options;
+  options.numberOfPoles = 3;
+  VectorFittingResult result = VectorFitting::fit(sweep, {0, 1}, options);
+  // Verify results.
+  ASSERT_EQ(result.numberOfPoles, 3);
+  EXPECT_LT(result.relativeRmsError, 1e-8);
+  const arma::cx_vec &fitted = result.model->getPoles();
+  EXPECT_NEAR(fitted(0).real(), poles(0).real(), 1e-6 * std::abs(poles(0)));
+  EXPECT_NEAR(fitted(1).real(), poles(1).real(), 1e-6 * std::abs(poles(1)));
+  EXPECT_NEAR(fitted(1).imag(), poles(1).imag(), 1e-6 * std::abs(poles(1)));
+  EXPECT_EQ(fitted(2), std::conj(fitted(1)));
+  EXPECT_NEAR(result.model->getConstants()(0).real(), 0.5, 1e-6);
+}
+
+/// @brief Test that the automatic order finds the order of a series RLC circuit.
+TEST(vector_fitting, fits_circuit_response) {
+  // Sweep example circuit 3 and fit the voltage across the resistor.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  FrequencySweepResult sweep =
+      FrequencySweep::run(circuit, FrequencySweep::logarithmicPoints(1.0f, 1.0e4f, 60), 2);
+  VectorFittingResult result = VectorFitting::fitBuses(circuit, sweep, {4});
+  // Compare with a solve at a frequency that was not sampled.
+  circuit->setFrequency(333.0f);
+  CircuitTransformer transformer(circuit);
+  auto expected = CircuitCalculator::solveVoltages(transformer.getAdmittanceMatrix(),
+                                                   transformer.getCurrentVector());
+  arma::uword row = transformer.getBusIdMap().at(4) - 1;
+  std::complex<double> value = result.model->evaluate(333.0f)(0);
+  // Verify results.
+  EXPECT_EQ(result.numberOfPoles, 2);
+  EXPECT_EQ(result.model->getNumberOfResponses(), 1);
+  EXPECT_LT(result.relativeRmsError, 1e-6);
+  EXPECT_LT(std::abs(value - (*expected)(row)), 1e-5 * std::abs((*expected)(row)));
+}
+
+/// @brief Test that the model evaluates many frequencies at once.
+TEST(vector_fitting, evaluates_frequency_list) {
+  // Build a one-pole model by hand: H(s) = 10 / (s + 10) + 1.
+  arma::cx_mat residues(1, 1);
+  residues(0, 0) = 10.0;
+  RationalModel model(arma::cx_vec{{-10.0, 0.0}}, residues, arma::cx_vec{{1.0, 0.0}});
+  arma::cx_mat values = model.evaluate(std::vector<float>{0.0f, 1.0e6f});
+  // Verify results.
+  EXPECT_NEAR(values(0, 0).real(), 2.0, 1e-12);
+  EXPECT_NEAR(std::abs(values(0, 1) - 1.0), 0.0, 1e-5);
+  EXPECT_THROW(RationalModel(arma::cx_vec(2), arma::cx_mat(1, 1), arma::cx_vec(1)),
+               std::runtime_error);
+}
+
+/// @brief Test that invalid selections are rejected.
+TEST(vector_fitting, rejects_invalid_input) {
+  // Sweep example circuit 3 at a handful of frequencies.
+  auto circuit = ExampleCircuitGenerator::getExampleCircuit3();
+  FrequencySweepResult sweep =
+      FrequencySweep::run(circuit, FrequencySweep::linearPoints(10.0f, 100.0f, 3), 1);
+  VectorFittingOptions options;
+  options.numberOfPoles = 10;
+  // Verify results.
+  EXPECT_THROW(VectorFitting::fit(sweep, {}), std::runtime_error);
+  EXPECT_THROW(VectorFitting::fit(sweep, {99}), std::runtime_error);
+  EXPECT_THROW(VectorFitting::fit(sweep, {0}, options), std::runtime_error);
+  EXPECT_THROW(VectorFitting::fitBuses(circuit, sweep, {1}), std::runtime_error);
+}